@@ -0,0 +1,624 @@
+// Author: realyoavperetz@gmail.com
+
+// Micro-benchmarks for the graph library.
+// Usage: ./bench.exe [filter]   runs every benchmark whose name contains filter
+
+#include "../include/Graph.hpp"
+#include "../include/CSRGraph.hpp"
+#include "../include/Algorithms.hpp"
+#include "../include/PriorityQueue.hpp"
+#include "../include/DaryPriorityQueue.hpp"
+#include "../include/Parallel.hpp"
+#include "../include/EdgeSort.hpp"
+#include "../include/UnionFind.hpp"
+#include "../include/ConcurrentUnionFind.hpp"
+#include "../include/EdgeListLoader.hpp"
+#include "../include/Landmarks.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+using namespace graph;
+
+// ----------------------------------------------------------
+// Helpers
+// ----------------------------------------------------------
+
+// Run fn once and return the elapsed wall time in milliseconds
+template <typename F>
+static double timeMs(F&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+static void report(const char* label, double ms) {
+    std::cout << "  " << label << ": " << ms << " ms" << std::endl;
+}
+
+// xorshift64 - deterministic and fast enough for input generation
+static unsigned long long rngState = 88172645463325252ULL;
+static unsigned int nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return static_cast<unsigned int>(rngState >> 32);
+}
+
+// Connected sparse graph: a random spanning path plus extra random edges
+static Edge* randomSparseEdges(int n, int edgeCount, int maxWeight) {
+    Edge* edges = new Edge[edgeCount];
+    for (int i = 0; i < edgeCount; ++i) {
+        int u = i < n - 1 ? i : nextRandom() % n;
+        int v = i < n - 1 ? i + 1 : nextRandom() % n;
+        edges[i] = {u, v, 1 + static_cast<int>(nextRandom() % maxWeight)};
+    }
+    return edges;
+}
+
+// ----------------------------------------------------------
+// Priority queue: indexed heap vs. the original linear-scan lookup
+// ----------------------------------------------------------
+
+// The pre-index decrease-key: scan vertices[] to find the slot
+class LinearScanQueue {
+private:
+    int* vertices;
+    int* distances;
+    int size;
+
+    void swap(int i, int j) {
+        int tv = vertices[i], td = distances[i];
+        vertices[i] = vertices[j]; distances[i] = distances[j];
+        vertices[j] = tv; distances[j] = td;
+    }
+    void heapifyUp(int i) {
+        while (i > 0 && distances[i] < distances[(i - 1) / 2]) {
+            swap(i, (i - 1) / 2);
+            i = (i - 1) / 2;
+        }
+    }
+    void heapifyDown(int i) {
+        while (true) {
+            int l = 2 * i + 1, r = l + 1, s = i;
+            if (l < size && distances[l] < distances[s]) s = l;
+            if (r < size && distances[r] < distances[s]) s = r;
+            if (s == i) return;
+            swap(i, s);
+            i = s;
+        }
+    }
+
+public:
+    LinearScanQueue(int cap) : vertices(new int[cap]), distances(new int[cap]), size(0) {}
+    ~LinearScanQueue() { delete[] vertices; delete[] distances; }
+    bool isEmpty() const { return size == 0; }
+    void insert(int v, int d) { vertices[size] = v; distances[size] = d; heapifyUp(size++); }
+    int extractMin() {
+        int v = vertices[0];
+        --size;
+        vertices[0] = vertices[size]; distances[0] = distances[size];
+        heapifyDown(0);
+        return v;
+    }
+    void updateDistance(int v, int d) {
+        for (int i = 0; i < size; ++i)
+            if (vertices[i] == v) { distances[i] = d; heapifyUp(i); return; }
+    }
+};
+
+// Dijkstra-shaped workload: insert all at infinity, then interleave
+// decrease-keys and extractions
+template <typename Q>
+static void pqWorkload(int n, int decreasesPerExtract) {
+    Q pq(n);
+    for (int v = 0; v < n; ++v)
+        pq.insert(v, std::numeric_limits<int>::max());
+    int key = 0;
+    while (!pq.isEmpty()) {
+        for (int k = 0; k < decreasesPerExtract; ++k)
+            pq.updateDistance(nextRandom() % n, key + static_cast<int>(nextRandom() % 1000));
+        pq.extractMin();
+        ++key;
+    }
+}
+
+static void benchPriorityQueue() {
+    const int small = 20000;
+    std::cout << "decrease-key workload, " << small << " vertices" << std::endl;
+    report("linear scan", timeMs([&] { pqWorkload<LinearScanQueue>(small, 4); }));
+    report("indexed heap", timeMs([&] { pqWorkload<PriorityQueue>(small, 4); }));
+
+    const int large = 1000000;
+    std::cout << "decrease-key workload, " << large << " vertices" << std::endl;
+    report("indexed heap", timeMs([&] { pqWorkload<PriorityQueue>(large, 4); }));
+}
+
+// ----------------------------------------------------------
+// Dijkstra on a 1M-vertex sparse graph
+// ----------------------------------------------------------
+
+static void benchDijkstra() {
+    const int n = 1000000;
+    const int m = 4 * n;
+    Edge* edges = randomSparseEdges(n, m, 100);
+    CSRGraph csr(n, edges, m);
+    Graph g(n);
+    for (int i = 0; i < m; ++i)
+        g.addEdge(edges[i].u, edges[i].v, edges[i].weight);
+    delete[] edges;
+
+    std::cout << "dijkstra, " << n << " vertices, " << m << " edges" << std::endl;
+    report("adjacency list", timeMs([&] { Algorithms::dijkstra(g, 0); }));
+    report("csr", timeMs([&] { Algorithms::dijkstra(csr, 0); }));
+}
+
+// ----------------------------------------------------------
+// Point-to-point queries on a road-like grid
+// ----------------------------------------------------------
+
+// side x side grid, vertex r * side + c linked to its right and lower
+// neighbors with random weights in [minWeight, maxWeight]; count is set to the edge count
+static Edge* gridEdges(int side, int minWeight, int maxWeight, int& count) {
+    Edge* edges = new Edge[2 * side * (side - 1)];
+    count = 0;
+    for (int r = 0; r < side; ++r) {
+        for (int c = 0; c < side; ++c) {
+            int v = r * side + c;
+            int span = maxWeight - minWeight + 1;
+            if (c + 1 < side) edges[count++] = {v, v + 1, minWeight + static_cast<int>(nextRandom() % span)};
+            if (r + 1 < side) edges[count++] = {v, v + side, minWeight + static_cast<int>(nextRandom() % span)};
+        }
+    }
+    return edges;
+}
+
+static void benchPointToPoint() {
+    const int side = 700, queries = 20;
+    int m = 0;
+    Edge* edges = gridEdges(side, 50, 100, m); // road-like: cost grows with length
+    CSRGraph csr(side * side, edges, m);
+    delete[] edges;
+
+    int sources[queries], targets[queries];
+    for (int i = 0; i < queries; ++i) {
+        sources[i] = nextRandom() % (side * side);
+        targets[i] = nextRandom() % (side * side);
+    }
+
+    std::cout << "s-t queries on a " << side << "x" << side << " grid, average of " << queries << std::endl;
+    report("dijkstraDistances", timeMs([&] {
+        for (int i = 0; i < queries; ++i) Algorithms::dijkstraDistances(csr, sources[i]);
+    }) / queries);
+    long long settled = 0;
+    report("shortestPath", timeMs([&] {
+        for (int i = 0; i < queries; ++i) settled += Algorithms::shortestPath(csr, sources[i], targets[i]).settled;
+    }) / queries);
+    std::cout << "  settled per query: " << settled / queries << " of " << side * side << std::endl;
+    SearchWorkspace workspace(side * side);
+    report("shortestPath (workspace)", timeMs([&] {
+        for (int i = 0; i < queries; ++i) Algorithms::shortestPath(csr, sources[i], targets[i], workspace);
+    }) / queries);
+
+    // Short queries (target a few rows away), where per-query setup dominates
+    int nearTargets[queries];
+    for (int i = 0; i < queries; ++i)
+        nearTargets[i] = (sources[i] + 3 * side + 2) % (side * side);
+    report("shortestPath, near target", timeMs([&] {
+        for (int i = 0; i < queries; ++i) Algorithms::shortestPath(csr, sources[i], nearTargets[i]);
+    }) / queries);
+    report("shortestPath, near target (workspace)", timeMs([&] {
+        for (int i = 0; i < queries; ++i) Algorithms::shortestPath(csr, sources[i], nearTargets[i], workspace);
+    }) / queries);
+
+    long long forward = 0, backward = 0;
+    report("bidirectionalDijkstra", timeMs([&] {
+        for (int i = 0; i < queries; ++i) {
+            PathResult p = Algorithms::bidirectionalDijkstra(csr, sources[i], targets[i]);
+            forward += p.settled;
+            backward += p.settledBackward;
+        }
+    }) / queries);
+    std::cout << "  settled per query: " << forward / queries << " forward + "
+              << backward / queries << " backward" << std::endl;
+    SearchWorkspace backwardSpace(side * side);
+    report("bidirectionalDijkstra, near target (workspaces)", timeMs([&] {
+        for (int i = 0; i < queries; ++i)
+            Algorithms::bidirectionalDijkstra(csr, sources[i], nearTargets[i], workspace, backwardSpace);
+    }) / queries);
+
+    // Grid positions; every edge weighs at least 50 times its length
+    double* x = new double[side * side];
+    double* y = new double[side * side];
+    for (int v = 0; v < side * side; ++v) {
+        x[v] = v % side;
+        y[v] = v / side;
+    }
+    ManhattanHeuristic manhattan(x, y, 50);
+    settled = 0;
+    report("astar (manhattan)", timeMs([&] {
+        for (int i = 0; i < queries; ++i) settled += Algorithms::astar(csr, sources[i], targets[i], manhattan).settled;
+    }) / queries);
+    std::cout << "  settled per query: " << settled / queries << std::endl;
+    delete[] x;
+    delete[] y;
+}
+
+// ----------------------------------------------------------
+// ALT landmarks vs. plain Dijkstra
+// ----------------------------------------------------------
+
+static void benchLandmarks() {
+    const int side = 700, queries = 20, landmarks = 16;
+    const char* path = "bench_landmarks.alt";
+    int m = 0;
+    Edge* edges = gridEdges(side, 50, 100, m);
+    CSRGraph csr(side * side, edges, m);
+    delete[] edges;
+
+    int sources[queries], targets[queries];
+    for (int i = 0; i < queries; ++i) {
+        sources[i] = nextRandom() % (side * side);
+        targets[i] = nextRandom() % (side * side);
+    }
+
+    std::cout << "ALT on a " << side << "x" << side << " grid, " << landmarks << " landmarks" << std::endl;
+    LandmarkIndex farthest(csr, 0);
+    report("build (farthest)", timeMs([&] { farthest = LandmarkIndex(csr, landmarks, LandmarkSelection::Farthest); }));
+    LandmarkIndex avoid(csr, 0);
+    report("build (avoid)", timeMs([&] { avoid = LandmarkIndex(csr, landmarks, LandmarkSelection::Avoid); }));
+    report("save", timeMs([&] { avoid.save(path); }));
+    LandmarkIndex loaded(csr, 0);
+    report("load", timeMs([&] { loaded = LandmarkIndex(path); }));
+    std::remove(path);
+
+    double dijkstraMs = timeMs([&] {
+        for (int i = 0; i < queries; ++i) Algorithms::dijkstra(csr, sources[i]);
+    }) / queries;
+    report("query: dijkstra", dijkstraMs);
+    report("query: shortestPath", timeMs([&] {
+        for (int i = 0; i < queries; ++i) Algorithms::shortestPath(csr, sources[i], targets[i]);
+    }) / queries);
+
+    const LandmarkIndex* indexes[] = {&farthest, &loaded};
+    const char* labels[] = {"query: alt (farthest)", "query: alt (avoid)"};
+    for (int k = 0; k < 2; ++k) {
+        long long settled = 0;
+        double ms = timeMs([&] {
+            for (int i = 0; i < queries; ++i) settled += indexes[k]->shortestPath(csr, sources[i], targets[i]).settled;
+        }) / queries;
+        report(labels[k], ms);
+        std::cout << "    settled per query: " << settled / queries << ", speedup vs dijkstra: "
+                  << dijkstraMs / ms << "x" << std::endl;
+    }
+}
+
+// ----------------------------------------------------------
+// Dijkstra heap arity comparison
+// ----------------------------------------------------------
+
+static void benchHeapArity() {
+    const int n = 1000000;
+    const int m = 3 * n; // road-network-like average degree
+    Edge* edges = randomSparseEdges(n, m, 1000);
+    CSRGraph csr(n, edges, m);
+    delete[] edges;
+
+    std::cout << "dijkstra by heap arity, " << n << " vertices, " << m << " edges (csr)" << std::endl;
+    report("PriorityQueue", timeMs([&] { Algorithms::dijkstra<PriorityQueue>(csr, 0); }));
+    report("DaryPriorityQueue<2>", timeMs([&] { Algorithms::dijkstra<DaryPriorityQueue<2>>(csr, 0); }));
+    report("DaryPriorityQueue<4>", timeMs([&] { Algorithms::dijkstra<DaryPriorityQueue<4>>(csr, 0); }));
+    report("DaryPriorityQueue<8>", timeMs([&] { Algorithms::dijkstra<DaryPriorityQueue<8>>(csr, 0); }));
+}
+
+// ----------------------------------------------------------
+// Dial's bucket queue vs. heaps on small integer weights
+// ----------------------------------------------------------
+
+static void benchBuckets() {
+    const int n = 1000000;
+    const int m = 3 * n;
+    Edge* edges = randomSparseEdges(n, m, 16);
+    CSRGraph csr(n, edges, m);
+    delete[] edges;
+
+    std::cout << "dijkstra, weights in [1, 16], " << n << " vertices, " << m << " edges (csr)" << std::endl;
+    report("PriorityQueue", timeMs([&] { Algorithms::dijkstra(csr, 0); }));
+    report("DaryPriorityQueue<4>", timeMs([&] { Algorithms::dijkstra<DaryPriorityQueue<4>>(csr, 0); }));
+    report("BucketQueue", timeMs([&] { Algorithms::dijkstraBuckets(csr, 0); }));
+}
+
+// ----------------------------------------------------------
+// BFS: top-down vs. direction-optimizing on a low-diameter graph
+// ----------------------------------------------------------
+
+// Uniform random edges (no spanning path), so the diameter stays small
+static Edge* randomUniformEdges(int n, int edgeCount, int maxWeight) {
+    Edge* edges = new Edge[edgeCount];
+    for (int i = 0; i < edgeCount; ++i)
+        edges[i] = {static_cast<int>(nextRandom() % n), static_cast<int>(nextRandom() % n),
+                    1 + static_cast<int>(nextRandom() % maxWeight)};
+    return edges;
+}
+
+static void benchBfs() {
+    const int n = 1000000;
+    const int m = 8 * n;
+    Edge* edges = randomUniformEdges(n, m, 100);
+    CSRGraph csr(n, edges, m);
+    delete[] edges;
+
+    std::cout << "bfs traversal, " << n << " vertices, " << m << " edges (csr)" << std::endl;
+    report("top-down", timeMs([&] { Algorithms::bfsTraversal(csr, 0); }));
+    report("direction-optimizing", timeMs([&] { Algorithms::bfsDirectionOptimizingTraversal(csr, 0); }));
+
+    int maxThreads = resolveThreadCount(0);
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        char label[64];
+        std::snprintf(label, sizeof(label), "parallel, %d threads", threads);
+        report(label, timeMs([&] { Algorithms::parallelBfsTraversal(csr, 0, threads); }));
+    }
+}
+
+// ----------------------------------------------------------
+// Minimum spanning forest
+// ----------------------------------------------------------
+
+static void benchMst() {
+    const int n = 1000000;
+    const int m = 4 * n;
+    Edge* edges = randomUniformEdges(n, m, 1000000);
+    CSRGraph csr(n, edges, m);
+    delete[] edges;
+
+    std::cout << "minimum spanning forest, " << n << " vertices, " << m << " edges (csr)" << std::endl;
+    report("kruskal", timeMs([&] { Algorithms::kruskal(csr); }));
+    int maxThreads = resolveThreadCount(0);
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        char label[64];
+        std::snprintf(label, sizeof(label), "boruvka, %d threads", threads);
+        report(label, timeMs([&] { Algorithms::boruvka(csr, threads); }));
+    }
+}
+
+// ----------------------------------------------------------
+// Edge sorting: recursive merge sort vs. parallel radix sort
+// ----------------------------------------------------------
+
+static void benchEdgeSortSize(int count) {
+    Edge* input = randomUniformEdges(1000000, count, 1 << 30);
+    Edge* work = new Edge[count];
+    auto reset = [&] {
+        for (int i = 0; i < count; ++i)
+            work[i] = input[i];
+    };
+
+    std::cout << "sort " << count << " edges by weight" << std::endl;
+    reset();
+    report("mergeSort", timeMs([&] { mergeSort(work, 0, count - 1); }));
+    reset();
+    report("sortEdges (introsort, total order)", timeMs([&] { sortEdges(work, count); }));
+    int maxThreads = resolveThreadCount(0);
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        char label[64];
+        std::snprintf(label, sizeof(label), "radixSortEdges, %d threads", threads);
+        reset();
+        report(label, timeMs([&] { radixSortEdges(work, count, threads); }));
+    }
+
+    delete[] work;
+    delete[] input;
+}
+
+static void benchEdgeSort() {
+    benchEdgeSortSize(10000000);
+}
+
+static void benchEdgeSortLarge() {
+    benchEdgeSortSize(100000000);
+}
+
+// ----------------------------------------------------------
+// Graph loading: addEdge, bulk insertion and the binary CSR file
+// ----------------------------------------------------------
+
+static void benchGraphFile() {
+    const int n = 1000000;
+    const int m = 8 * n;
+    const char* path = "bench_graph.csr";
+    Edge* edges = randomUniformEdges(n, m, 100);
+
+    std::cout << "graph loading, " << n << " vertices, " << m << " edges" << std::endl;
+    Graph perEdge(n), bulk(n);
+    report("addEdge per edge", timeMs([&] {
+        for (int i = 0; i < m; ++i)
+            perEdge.addEdge(edges[i].u, edges[i].v, edges[i].weight);
+    }));
+    report("addEdges bulk", timeMs([&] { bulk.addEdges(edges, m); }));
+    // Bulk rows are contiguous in memory, which pays off on every traversal
+    report("bfs, per-edge graph", timeMs([&] { Algorithms::bfsTraversal(perEdge, 0); }));
+    report("bfs, bulk graph", timeMs([&] { Algorithms::bfsTraversal(bulk, 0); }));
+    report("csr from edge list", timeMs([&] { CSRGraph csr(n, edges, m); }));
+
+    CSRGraph(n, edges, m).save(path);
+    delete[] edges;
+    report("open mapped file", timeMs([&] { CSRGraph mapped(path); }));
+    report("open mapped file + bfs", timeMs([&] {
+        CSRGraph mapped(path);
+        Algorithms::bfsTraversal(mapped, 0);
+    }));
+    std::remove(path);
+}
+
+// ----------------------------------------------------------
+// Text edge-list parsing across thread counts
+// ----------------------------------------------------------
+
+static void benchEdgeListLoader() {
+    const int n = 1000000;
+    const int m = 8 * n;
+    const char* path = "bench_edges.txt";
+    Edge* edges = randomUniformEdges(n, m, 1000);
+    std::FILE* file = std::fopen(path, "w");
+    for (int i = 0; i < m; ++i)
+        std::fprintf(file, "%d %d %d\n", edges[i].u, edges[i].v, edges[i].weight);
+    long bytes = std::ftell(file);
+    std::fclose(file);
+    delete[] edges;
+
+    std::cout << "edge-list parsing, " << m << " lines, " << bytes / (1 << 20) << " MB" << std::endl;
+    int maxThreads = resolveThreadCount(0);
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double ms = timeMs([&] {
+            int numVertices, count;
+            delete[] parseEdgeList(path, numVertices, count, threads);
+        });
+        char label[64];
+        std::snprintf(label, sizeof(label), "parse, %d threads (%.0f MB/s)", threads,
+                      bytes / 1048576.0 / (ms / 1000));
+        report(label, ms);
+    }
+    report("parse + build csr", timeMs([&] { loadEdgeList(path); }));
+    std::remove(path);
+}
+
+// ----------------------------------------------------------
+// Edge index: hub lookups and removals
+// ----------------------------------------------------------
+
+// Star around a hub of the given degree, then look up and remove every spoke
+static void edgeIndexWorkload(bool indexed, int degree) {
+    Graph g(degree + 1);
+    if (indexed) g.enableEdgeIndex();
+    for (int v = 1; v <= degree; ++v)
+        g.addEdge(0, v, v);
+    long long sum = 0;
+    for (int v = degree; v >= 1; v -= 2)
+        if (g.hasEdge(0, v)) sum += g.getWeight(v, 0);
+    for (int v = 1; v <= degree; ++v)
+        g.removeEdge(v, 0);
+    if (sum < 0) std::cout << sum;
+}
+
+static void benchEdgeIndex() {
+    const int degree = 50000;
+    std::cout << "hub lookups and removals, degree " << degree << std::endl;
+    report("list scans", timeMs([&] { edgeIndexWorkload(false, degree); }));
+    report("edge index", timeMs([&] { edgeIndexWorkload(true, degree); }));
+}
+
+// ----------------------------------------------------------
+// Vertex/weight types: node size vs. Dijkstra time
+// ----------------------------------------------------------
+
+// Bulk-build the same edges as a BasicGraph<V, W> and time dijkstraDistances
+template <typename V, typename W>
+static void weightTypeRun(const char* label, const Edge* edges, int n, int edgeCount) {
+    typedef BasicEdge<V, W> TypedEdge;
+    TypedEdge* typed = new TypedEdge[edgeCount];
+    for (int i = 0; i < edgeCount; ++i)
+        typed[i] = {(V)edges[i].u, (V)edges[i].v, (W)edges[i].weight};
+    BasicGraph<V, W> g(n);
+    g.addEdges(typed, edgeCount);
+    delete[] typed;
+
+    double ms = timeMs([&] { Algorithms::dijkstraDistances(g, 0); });
+    std::cout << "  " << label << " (" << sizeof(BasicNeighbor<V, W>) << "-byte nodes): "
+              << ms << " ms" << std::endl;
+}
+
+static void benchWeightTypes() {
+    const int n = 1000000, edgeCount = 5000000;
+    Edge* edges = randomSparseEdges(n, edgeCount, 1000);
+    std::cout << "dijkstraDistances, V=" << n << " E=" << edgeCount << std::endl;
+    weightTypeRun<int, unsigned short>("int / unsigned short", edges, n, edgeCount);
+    weightTypeRun<int, int>("int / int", edges, n, edgeCount);
+    weightTypeRun<int, float>("int / float", edges, n, edgeCount);
+    weightTypeRun<long long, double>("long long / double", edges, n, edgeCount);
+    delete[] edges;
+}
+
+// ----------------------------------------------------------
+// Union-find throughput: sequential vs. lock-free
+// ----------------------------------------------------------
+
+static void benchUnionFind() {
+    const int n = 10000000;
+    const int ops = 20000000;
+    int* xs = new int[ops];
+    int* ys = new int[ops];
+    for (int i = 0; i < ops; ++i) {
+        xs[i] = nextRandom() % n;
+        ys[i] = nextRandom() % n;
+    }
+
+    std::cout << ops << " unite+connected pairs over " << n << " elements" << std::endl;
+    {
+        UnionFind uf(n);
+        report("UnionFind", timeMs([&] {
+            for (int i = 0; i < ops; ++i) {
+                uf.unite(xs[i], ys[i]);
+                uf.connected(ys[i], xs[ops - 1 - i]);
+            }
+        }));
+    }
+    int maxThreads = resolveThreadCount(0);
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        ConcurrentUnionFind uf(n);
+        char label[64];
+        std::snprintf(label, sizeof(label), "ConcurrentUnionFind, %d threads", threads);
+        report(label, timeMs([&] {
+            runParallel(threads, [&](int t) {
+                for (int i = t; i < ops; i += threads) {
+                    uf.unite(xs[i], ys[i]);
+                    uf.connected(ys[i], xs[ops - 1 - i]);
+                }
+            });
+        }));
+    }
+
+    delete[] xs;
+    delete[] ys;
+}
+
+// ----------------------------------------------------------
+// Registry
+// ----------------------------------------------------------
+
+struct Benchmark {
+    const char* name;
+    void (*run)();
+    bool explicitOnly; // run only when the filter is exactly this name
+};
+
+static const Benchmark benchmarks[] = {
+    {"priority-queue", benchPriorityQueue, false},
+    {"dijkstra", benchDijkstra, false},
+    {"heap-arity", benchHeapArity, false},
+    {"buckets", benchBuckets, false},
+    {"bfs", benchBfs, false},
+    {"mst", benchMst, false},
+    {"edge-sort", benchEdgeSort, false},
+    {"union-find", benchUnionFind, false},
+    {"graph-file", benchGraphFile, false},
+    {"edge-list", benchEdgeListLoader, false},
+    {"edge-index", benchEdgeIndex, false},
+    {"weight-types", benchWeightTypes, false},
+    {"point-to-point", benchPointToPoint, false},
+    {"landmarks", benchLandmarks, false},
+    {"edge-sort-100m", benchEdgeSortLarge, true}, // needs ~3.5 GB of memory
+};
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : "";
+    for (const Benchmark& b : benchmarks) {
+        if (std::strstr(b.name, filter) == nullptr) continue;
+        if (b.explicitOnly && std::strcmp(b.name, filter) != 0) continue;
+        std::cout << "[" << b.name << "]" << std::endl;
+        b.run();
+    }
+    return 0;
+}
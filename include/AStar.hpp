@@ -0,0 +1,130 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include "Adjacency.hpp"
+#include "Results.hpp"
+#include "SearchWorkspace.hpp"
+
+namespace graph {
+
+/*
+A* heuristics: h(v, target) estimates the distance from v to target and
+must never exceed it (admissible). Heuristics are passed as template
+parameters, so the call inlines into the search loop.
+
+The estimate is converted to the graph's DistanceType; for integer
+weights that rounds it down, which keeps it admissible.
+*/
+
+// h = 0: A* degenerates to Dijkstra
+struct ZeroHeuristic {
+    template <typename V>
+    int operator()(V, V) const { return 0; }
+};
+
+/*
+Straight-line distance over per-vertex coordinates (x[v], y[v]), times
+scale. Admissible if every edge weighs at least scale times the distance
+between its endpoints. A NaN coordinate marks a vertex without a
+position; its estimate is 0.
+*/
+class EuclideanHeuristic {
+private:
+    const double* x;
+    const double* y;
+    double scale;
+
+public:
+    EuclideanHeuristic(const double* x, const double* y, double scale = 1.0) : x(x), y(y), scale(scale) {}
+
+    template <typename V>
+    double operator()(V v, V target) const {
+        double dx = x[v] - x[target];
+        double dy = y[v] - y[target];
+        double d = std::sqrt(dx * dx + dy * dy) * scale;
+        return d == d ? d : 0.0; // NaN: unknown position
+    }
+};
+
+/*
+|dx| + |dy| over per-vertex coordinates, times scale. Admissible on
+grid-like graphs whose edges only move along one axis and weigh at least
+scale times their length. NaN coordinates give 0, as above.
+*/
+class ManhattanHeuristic {
+private:
+    const double* x;
+    const double* y;
+    double scale;
+
+public:
+    ManhattanHeuristic(const double* x, const double* y, double scale = 1.0) : x(x), y(y), scale(scale) {}
+
+    template <typename V>
+    double operator()(V v, V target) const {
+        double d = (std::fabs(x[v] - x[target]) + std::fabs(y[v] - y[target])) * scale;
+        return d == d ? d : 0.0;
+    }
+};
+
+/*
+A* search from source to target on any backend, in a workspace with room
+for every vertex of g: vertices are ordered by dist[v] + h(v, target),
+inserted on discovery, and the search stops when target is extracted. A
+vertex whose distance improves after it was extracted is put back in the
+heap, so the result is exact for any admissible heuristic. A consistent
+heuristic (h(u) <= w(u, v) + h(v) on every edge) never reopens a vertex.
+ZeroHeuristic is consistent, and so are the two above when every vertex
+has coordinates and each edge weighs at least scale times its length; a
+NaN coordinate drops the estimate to 0 at one vertex and breaks that.
+result.settled counts distinct vertices, a reopened one only once.
+*/
+template <typename G, typename PQ, typename H>
+BasicPathResult<typename G::VertexType, typename G::DistanceType>
+astarSearch(const G& g, typename G::VertexType source, typename G::VertexType target,
+            BasicSearchWorkspace<typename G::VertexType, typename G::DistanceType, PQ>& workspace,
+            const H& heuristic) {
+    typedef typename G::VertexType V;
+    typedef typename G::DistanceType D;
+    g.validateVertex(source);
+    g.validateVertex(target);
+    if (workspace.getNumVertices() < g.getNumVertices()) {
+        throw "Workspace is too small for the graph";
+    }
+
+    BasicPathResult<V, D> result(source, target);
+    PQ& pq = workspace.queue();
+    workspace.reset();
+    workspace.reach(source, 0, -1);
+    pq.insert(source, static_cast<D>(heuristic(source, target)));
+    while (!pq.isEmpty()) {
+        V u = pq.extractMin();
+        if (workspace.settle(u)) ++result.settled;
+        D distU = workspace.distance(u);
+        if (u == target) {
+            result.tracePath(workspace.parents(), distU);
+            break;
+        }
+
+        for (auto it = neighbors(g, u); it.valid(); it.next()) {
+            V v = it.vertex();
+            D weight = it.weight();
+            if (weight < 0)
+                throw "Graph contains a negative weight edge – Dijkstra is not allowed";
+            if (distU + weight >= workspace.distance(v)) continue;
+
+            workspace.reach(v, distU + weight, u);
+            D key = distU + weight + static_cast<D>(heuristic(v, target));
+            if (pq.contains(v))
+                pq.updateDistance(v, key);
+            else
+                pq.insert(v, key);
+        }
+    }
+    return result;
+}
+
+}
@@ -0,0 +1,88 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include "Graph.hpp"
+#include "CSRGraph.hpp"
+
+namespace graph {
+
+/*
+Neighbor cursors: a uniform way to walk the neighbors of a vertex on
+either storage backend, so one algorithm body serves both.
+
+    for (auto it = neighbors(g, u); it.valid(); it.next())
+        use(it.vertex(), it.weight());
+*/
+
+// Cursor over a linked adjacency list
+template <typename VertexT, typename WeightT>
+class BasicListCursor {
+private:
+    const BasicNeighbor<VertexT, WeightT>* current;
+
+public:
+    BasicListCursor() : current(nullptr) {}
+    BasicListCursor(const BasicGraph<VertexT, WeightT>& g, VertexT u) : current(g.getNeighbors(u)) {}
+
+    bool valid() const { return current != nullptr; }
+    void next() { current = current->next; }
+    VertexT vertex() const { return current->vertex; }
+    WeightT weight() const { return current->weight; }
+};
+
+typedef BasicListCursor<int, int> ListCursor;
+
+// Cursor over one CSR row
+class CSRCursor {
+private:
+    const CSRGraph* g;
+    int index;
+    int last;
+
+public:
+    CSRCursor() : g(nullptr), index(0), last(0) {}
+    CSRCursor(const CSRGraph& g, int u) : g(&g), index(g.begin(u)), last(g.end(u)) {}
+
+    bool valid() const { return index < last; }
+    void next() { ++index; }
+    int vertex() const { return g->target(index); }
+    int weight() const { return g->weight(index); }
+};
+
+template <typename VertexT, typename WeightT>
+BasicListCursor<VertexT, WeightT> neighbors(const BasicGraph<VertexT, WeightT>& g,
+                                            typename BasicGraph<VertexT, WeightT>::VertexType u) {
+    return BasicListCursor<VertexT, WeightT>(g, u);
+}
+inline CSRCursor neighbors(const CSRGraph& g, int u) { return CSRCursor(g, u); }
+
+// Throw unless g is undirected (for algorithms defined on undirected graphs only)
+template <typename G>
+void requireUndirected(const G& g) {
+    if (g.isDirected())
+        throw "Algorithm needs an undirected graph";
+}
+
+// Number of undirected edges u < v (self-loops are skipped)
+template <typename G>
+int countEdges(const G& g) {
+    int count = 0;
+    for (int u = 0; u < g.getNumVertices(); ++u)
+        for (auto it = neighbors(g, u); it.valid(); it.next())
+            if (u < it.vertex()) ++count;
+    return count;
+}
+
+// Write every edge u < v into edges (sized by countEdges), ordered by u
+// and then by adjacency order; returns the number of edges written
+template <typename G>
+int collectEdges(const G& g, Edge* edges) {
+    int count = 0;
+    for (int u = 0; u < g.getNumVertices(); ++u)
+        for (auto it = neighbors(g, u); it.valid(); it.next())
+            if (u < it.vertex()) edges[count++] = {u, it.vertex(), it.weight()};
+    return count;
+}
+
+}
@@ -3,10 +3,32 @@
 #pragma once
 
 #include "Graph.hpp"
+#include "CSRGraph.hpp"
+#include "PriorityQueue.hpp"
+#include "DaryPriorityQueue.hpp"
+#include "Results.hpp"
+#include "AStar.hpp"
+#include "SearchWorkspace.hpp"
 #include "../include/Queue.hpp"
 
 namespace graph {
 
+// Same type as T; keeps a parameter out of template argument deduction, so
+// bfs(g, 0) works on a BasicGraph<long long, W> and explicitly named
+// dijkstra<PQ, G> instantiations never look inside BasicGraph<PQ, G>
+template <typename T>
+struct NonDeduced {
+    typedef T type;
+};
+
+/*
+Every algorithm is available for both storage backends: the adjacency list
+Graph and the read-only CSRGraph. Results are always returned as a Graph.
+
+On directed graphs the traversals and Dijkstra follow out-edges and return
+directed trees; the minimum spanning tree algorithms (prim, kruskal,
+boruvka) need an undirected graph and throw otherwise.
+*/
 class Algorithms {
 public:
     /*
@@ -16,6 +38,39 @@ public:
     returns a BFS tree
     */
     static Graph bfs(const Graph& g, int source);
+    static Graph bfs(const CSRGraph& g, int source);
+
+    // BFS without building a tree: visiting order, parents and depths
+    static TraversalResult bfsTraversal(const Graph& g, int source);
+    static TraversalResult bfsTraversal(const CSRGraph& g, int source);
+
+    /*
+    Direction-optimizing BFS:
+    expands small frontiers top-down and large frontiers bottom-up (every
+    unvisited vertex searches the frontier bitmap for a parent). Switches to
+    bottom-up when frontier edges exceed unexplored edges / alpha, and back
+    when the frontier has fewer than n / beta vertices.
+
+    returns a BFS tree (same depths as bfs; parents may differ on ties).
+    Directed graphs are searched top-down only.
+    */
+    static Graph bfsDirectionOptimizing(const Graph& g, int source, int alpha = 14, int beta = 24);
+    static Graph bfsDirectionOptimizing(const CSRGraph& g, int source, int alpha = 14, int beta = 24);
+    static TraversalResult bfsDirectionOptimizingTraversal(const Graph& g, int source, int alpha = 14, int beta = 24);
+    static TraversalResult bfsDirectionOptimizingTraversal(const CSRGraph& g, int source, int alpha = 14, int beta = 24);
+
+    /*
+    Parallel BFS:
+    level-synchronous BFS whose levels are expanded by numThreads threads
+    (0 = one per hardware thread); vertices are claimed with an atomic
+    compare-and-swap on their parent.
+
+    returns a BFS tree (same depths as bfs; parents may differ on ties)
+    */
+    static Graph parallelBfs(const Graph& g, int source, int numThreads = 0);
+    static Graph parallelBfs(const CSRGraph& g, int source, int numThreads = 0);
+    static TraversalResult parallelBfsTraversal(const Graph& g, int source, int numThreads = 0);
+    static TraversalResult parallelBfsTraversal(const CSRGraph& g, int source, int numThreads = 0);
 
     /*
     DFS: gets a graph and a source vertex, returns a graph (tree or forest)
@@ -24,15 +79,105 @@ public:
     returns a DFS tree
     */ 
     static Graph dfs(const Graph& g, int source);
+    static Graph dfs(const CSRGraph& g, int source);
+
+    // DFS without building a tree: preorder, parents and depths, and
+    // optionally discovery/finish timestamps
+    static TraversalResult dfsTraversal(const Graph& g, int source, bool timestamps = false);
+    static TraversalResult dfsTraversal(const CSRGraph& g, int source, bool timestamps = false);
 
     /*
     Dijkstra: 
     Use a min-priority queue to always process the vertex with the current
     shortest known distance.
+    When several shortest paths tie, the parent of v is the smallest u with
+    dist[u] + w(u, v) == dist[v] and w > 0 (vertices reached only through
+    zero-weight edges are attached breadth-first), so the tree does not
+    depend on the queue.
+    This is a deliberate change from the original implementation, whose
+    parent was the first tight predecessor the binary heap happened to
+    extract: the bucket queue of dijkstraBuckets orders equal keys
+    differently and cannot reproduce that order. Distances, and the tree
+    wherever shortest paths are unique, are unchanged.
 
     returns the shortest path tree
     */ 
     static Graph dijkstra(const Graph& g, int source);
+    static Graph dijkstra(const CSRGraph& g, int source);
+
+    // Dijkstra without building a tree: distances and predecessors only
+    static ShortestPathResult dijkstraDistances(const Graph& g, int source);
+    static ShortestPathResult dijkstraDistances(const CSRGraph& g, int source);
+
+    /*
+    Point-to-point Dijkstra: stops as soon as target is settled, and a
+    vertex enters the heap only when it is first reached, so a query near
+    the source touches a small part of the graph. Without a workspace the
+    per-vertex arrays are allocated for all n vertices on every call; pass
+    a SearchWorkspace to reuse them, so a query costs only the part of the
+    graph it explores.
+
+    returns the path from source to target and its cost (found() is false
+    if target is unreachable)
+    */
+    static PathResult shortestPath(const Graph& g, int source, int target);
+    static PathResult shortestPath(const CSRGraph& g, int source, int target);
+    static PathResult shortestPath(const Graph& g, int source, int target, SearchWorkspace& workspace);
+    static PathResult shortestPath(const CSRGraph& g, int source, int target, SearchWorkspace& workspace);
+
+    /*
+    Bidirectional Dijkstra (undirected graphs only):
+    searches from source and from target at once and stops when the two
+    searches cannot improve the best path through a vertex both reached,
+    which on road-like graphs settles about half as many vertices as
+    shortestPath. settled and settledBackward count each side's work.
+    Each side runs in its own workspace; pass two to reuse them across
+    queries.
+
+    returns the path from source to target and its cost
+    */
+    static PathResult bidirectionalDijkstra(const Graph& g, int source, int target);
+    static PathResult bidirectionalDijkstra(const CSRGraph& g, int source, int target);
+    static PathResult bidirectionalDijkstra(const Graph& g, int source, int target, SearchWorkspace& forward,
+                                            SearchWorkspace& backward);
+    static PathResult bidirectionalDijkstra(const CSRGraph& g, int source, int target, SearchWorkspace& forward,
+                                            SearchWorkspace& backward);
+
+    /*
+    A*: shortestPath guided by a heuristic h(v, target) that never
+    overestimates the remaining distance (see AStar.hpp for
+    EuclideanHeuristic and ManhattanHeuristic over vertex coordinates).
+    The closer h is to the true distance, the fewer vertices are settled.
+    Works on every backend; the heap is 4-ary unless a workspace with
+    another queue is passed.
+
+    returns the path from source to target and its cost
+    */
+    template <typename G, typename H>
+    static BasicPathResult<typename G::VertexType, typename G::DistanceType>
+    astar(const G& g, typename G::VertexType source, typename G::VertexType target, const H& heuristic);
+    template <typename G, typename H, typename PQ>
+    static BasicPathResult<typename G::VertexType, typename G::DistanceType>
+    astar(const G& g, typename G::VertexType source, typename G::VertexType target, const H& heuristic,
+          BasicSearchWorkspace<typename G::VertexType, typename G::DistanceType, PQ>& workspace);
+
+    // Dijkstra with a chosen priority queue, e.g. dijkstra<DaryPriorityQueue<4>>(g, 0).
+    // Instantiated for PriorityQueue and DaryPriorityQueue<2/4/8> on both backends.
+    template <typename PQ, typename G>
+    static Graph dijkstra(const G& g, int source);
+
+    /*
+    Dijkstra for small non-negative integer weights:
+    if every edge weight is at most weightLimit, runs on Dial's bucket queue
+    (O(1) decrease-key, O(E + V * maxWeight) total); otherwise it falls back
+    to the binary heap. The tree is identical to dijkstra's: on ties every
+    Dijkstra variant picks the parent by the same rule (smallest vertex id
+    over a positive-weight edge), not by the queue's extraction order.
+
+    returns the shortest path tree
+    */
+    static Graph dijkstraBuckets(const Graph& g, int source, int weightLimit = 1 << 16);
+    static Graph dijkstraBuckets(const CSRGraph& g, int source, int weightLimit = 1 << 16);
 
     /*
     Prim : 
@@ -42,6 +187,11 @@ public:
     returns the minimum spanning tree (only for connected graphs)
     */
     static Graph prim(const Graph& g);
+    static Graph prim(const CSRGraph& g);
+
+    // Prim with a chosen priority queue (same instantiations as dijkstra)
+    template <typename PQ, typename G>
+    static Graph prim(const G& g);
 
     /*
     Kruskal: Greedily adds the lightest edges to the MST, as long as they don’t form a cycle.
@@ -49,6 +199,79 @@ public:
     returns the minimum spanning tree (for any graph)
     */ 
     static Graph kruskal(const Graph& g);
+    static Graph kruskal(const CSRGraph& g);
+
+    // Kruskal that sorts all edges with the parallel radix sort on
+    // numThreads threads (0 = one per core); returns the same forest
+    static Graph kruskal(const Graph& g, int numThreads);
+    static Graph kruskal(const CSRGraph& g, int numThreads);
+
+    /*
+    Boruvka: every round, each component adds its lightest outgoing edge;
+    the edge scan runs on numThreads threads (0 = one per hardware thread).
+
+    returns the same minimum spanning forest as kruskal (for any graph)
+    */
+    static Graph boruvka(const Graph& g, int numThreads = 0);
+    static Graph boruvka(const CSRGraph& g, int numThreads = 0);
+
+    /*
+    Generic traversals and Dijkstra for any BasicGraph<V, W> listed in
+    GRAPH_FOR_EACH_TYPE_PAIR, e.g. 64-bit vertex ids or double weights. The
+    bodies are the same templates as above, compiled per type pair; the
+    int/int Graph keeps using the overloads above. Dijkstra runs on a 4-ary
+    heap keyed by the graph's DistanceType. The MST algorithms are int/int only.
+    */
+    template <typename V, typename W>
+    static BasicGraph<V, W> bfs(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source);
+    template <typename V, typename W>
+    static BasicTraversalResult<V> bfsTraversal(const BasicGraph<V, W>& g,
+                                                typename NonDeduced<V>::type source);
+    template <typename V, typename W>
+    static BasicGraph<V, W> dfs(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source);
+    template <typename V, typename W>
+    static BasicTraversalResult<V> dfsTraversal(const BasicGraph<V, W>& g,
+                                                typename NonDeduced<V>::type source,
+                                                bool timestamps = false);
+    template <typename V, typename W>
+    static BasicGraph<V, W> dijkstra(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source);
+    template <typename V, typename W>
+    static BasicShortestPathResult<V, typename BasicGraph<V, W>::DistanceType>
+    dijkstraDistances(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source);
+    template <typename V, typename W>
+    static BasicPathResult<V, typename BasicGraph<V, W>::DistanceType>
+    shortestPath(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source,
+                 typename NonDeduced<V>::type target);
+    template <typename V, typename W>
+    static BasicPathResult<V, typename BasicGraph<V, W>::DistanceType>
+    shortestPath(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source,
+                 typename NonDeduced<V>::type target,
+                 BasicSearchWorkspace<V, typename BasicGraph<V, W>::DistanceType>& workspace);
+    template <typename V, typename W>
+    static BasicPathResult<V, typename BasicGraph<V, W>::DistanceType>
+    bidirectionalDijkstra(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source,
+                          typename NonDeduced<V>::type target);
+    template <typename V, typename W>
+    static BasicPathResult<V, typename BasicGraph<V, W>::DistanceType>
+    bidirectionalDijkstra(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source,
+                          typename NonDeduced<V>::type target,
+                          BasicSearchWorkspace<V, typename BasicGraph<V, W>::DistanceType>& forward,
+                          BasicSearchWorkspace<V, typename BasicGraph<V, W>::DistanceType>& backward);
 };
 
+// Header-only so that any heuristic type inlines into the search
+template <typename G, typename H>
+BasicPathResult<typename G::VertexType, typename G::DistanceType>
+Algorithms::astar(const G& g, typename G::VertexType source, typename G::VertexType target, const H& heuristic) {
+    BasicSearchWorkspace<typename G::VertexType, typename G::DistanceType> workspace(g.getNumVertices());
+    return astarSearch(g, source, target, workspace, heuristic);
+}
+
+template <typename G, typename H, typename PQ>
+BasicPathResult<typename G::VertexType, typename G::DistanceType>
+Algorithms::astar(const G& g, typename G::VertexType source, typename G::VertexType target, const H& heuristic,
+                  BasicSearchWorkspace<typename G::VertexType, typename G::DistanceType, PQ>& workspace) {
+    return astarSearch(g, source, target, workspace, heuristic);
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,37 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include <cstdint>
+
+namespace graph {
+
+// Fixed-size bit set over [0, size), one bit per vertex
+class Bitmap {
+private:
+    uint64_t* words;
+    int numWords;
+
+public:
+    Bitmap(int size) : numWords((size + 63) / 64) {
+        words = new uint64_t[numWords]();
+    }
+
+    ~Bitmap() {
+        delete[] words;
+    }
+
+    Bitmap(const Bitmap&) = delete;
+    Bitmap& operator=(const Bitmap&) = delete;
+
+    bool test(int i) const { return (words[i >> 6] >> (i & 63)) & 1; }
+    void set(int i) { words[i >> 6] |= uint64_t(1) << (i & 63); }
+
+    // Clear every bit
+    void reset() {
+        for (int w = 0; w < numWords; ++w)
+            words[w] = 0;
+    }
+};
+
+}
@@ -0,0 +1,64 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+namespace graph {
+
+/*
+Dial's bucket queue: a monotone priority queue for small non-negative
+integer keys, with the same interface as PriorityQueue.
+
+When every edge weight is at most maxWeight, all finite keys waiting in
+Dijkstra lie in [d, d + maxWeight] where d is the last extracted key, so
+maxWeight + 1 circular buckets are enough. insert, updateDistance and
+contains are O(1); extractMin advances a cursor over the buckets.
+
+Keys must never be smaller than the last extracted key (monotone). A key
+of INT_MAX ("infinite") is parked outside the buckets, which lets
+Dijkstra insert every vertex up front as it does with PriorityQueue.
+Vertex IDs must be in [0, capacity).
+*/
+class BucketQueue {
+private:
+    int* keys;         // keys[v] = current key of vertex v
+    int* bucketOf;     // bucket index of v, numBuckets when parked, -1 if absent
+    int* nextInList;   // doubly linked bucket lists, indexed by vertex
+    int* prevInList;
+    int* heads;        // heads[b] = first vertex of bucket b, heads[numBuckets] = parked list
+    int numBuckets;    // maxWeight + 1
+    int capacity;
+    int finiteCount;   // vertices currently stored in buckets
+    int parkedCount;   // vertices currently stored with an infinite key
+    int cursorKey;     // smallest key that can still be in a bucket
+
+    void link(int vertex, int bucket);
+    void unlink(int vertex);
+    void place(int vertex, int key); // put vertex in the list matching key
+
+public:
+    BucketQueue(int capacity, int maxWeight);
+    ~BucketQueue();
+
+    BucketQueue(const BucketQueue&) = delete;
+    BucketQueue& operator=(const BucketQueue&) = delete;
+
+    // Returns true if queue is empty
+    bool isEmpty() const;
+
+    // Insert a (vertex, distance) pair into the queue
+    void insert(int vertex, int distance);
+
+    // Remove and return the vertex with the smallest distance
+    int extractMin();
+
+    // Check if queue currently contains this vertex
+    bool contains(int vertex) const;
+
+    // Get the stored distance for a vertex (if found)
+    int getDistance(int vertex) const;
+
+    // Update the distance of a vertex (if it exists in the queue)
+    void updateDistance(int vertex, int newDist);
+};
+
+}
@@ -0,0 +1,114 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include <cstddef>
+#include "Graph.hpp"
+
+namespace graph {
+
+/*
+Compressed Sparse Row (CSR) graph:
+the neighbors of vertex v are stored contiguously in targets/weights at
+indices [offsets[v], offsets[v + 1]), so walking a neighbor list is a
+linear scan instead of a pointer chase.
+
+The structure is immutable once built. Neighbor order matches the order
+an adjacency list Graph would report for the same input, so every
+algorithm returns the same tree on both backends.
+
+A CSRGraph can be saved to a binary file and reopened with mmap: the
+arrays then point straight into the mapped file, so opening takes O(1)
+regardless of the graph size and pages are read on first touch.
+
+File format (version 2, native byte order, 40-byte header):
+    char     magic[8]        "GRAPHCSR"
+    uint32   version         2
+    uint32   byteOrder       0x01020304 as written by the saving machine
+    int64    numVertices
+    int64    numEntries
+    uint32   flags           bit 0: directed
+    uint32   reserved        0
+    int32    offsets[numVertices + 1]
+    int32    targets[numEntries]
+    int32    weights[numEntries]
+
+Version 1 files (32-byte header without flags, always undirected) can
+still be opened.
+
+Opening checks only the header, the file size and the two ends of the
+offsets. For files from outside sources, call validate() once after
+opening: it reads the whole file (O(n + m)) and rejects offsets that
+decrease and targets outside [0, n), which would make the algorithms
+read out of bounds.
+*/
+class CSRGraph {
+public:
+    typedef int VertexType;
+    typedef int WeightType;
+    typedef int DistanceType;
+
+private:
+    int numVertices;
+    int numEntries;   // number of adjacency entries (two per undirected edge)
+    bool directed;    // rows hold out-neighbors only
+    int* offsets;     // numVertices + 1 row offsets into targets/weights
+    int* targets;     // neighbor vertex of each entry
+    int* weights;     // edge weight of each entry
+    void* mapping;    // mmap'ed file backing the arrays, or nullptr if they are owned
+    size_t mappingSize;
+
+public:
+    // Build from an existing adjacency list graph
+    CSRGraph(const Graph& g);
+
+    // Build from an edge list, as if addEdge was called per edge; throws if the
+    // adjacency entries (two per undirected edge) exceed the int32 offsets
+    CSRGraph(int numVertices, const Edge* edges, int edgeCount, bool directed = false);
+
+    // Same, for edges split into numChunks arrays, taken in chunk order
+    CSRGraph(int numVertices, const Edge* const* chunks, const int* chunkSizes, int numChunks,
+             bool directed = false);
+
+    // Open a file written by save() as a read-only view (no copy)
+    explicit CSRGraph(const char* path);
+
+    ~CSRGraph();
+
+    CSRGraph(const CSRGraph&) = delete;
+    CSRGraph& operator=(const CSRGraph&) = delete;
+
+    // Move: take over the arrays (or the mapping) of other
+    CSRGraph(CSRGraph&& other) noexcept;
+    CSRGraph& operator=(CSRGraph&& other) noexcept;
+
+    void validateVertex(int v) const;
+    int getNumVertices() const;
+    int getNumEntries() const;
+    bool isDirected() const;
+    int degree(int v) const;
+    void printGraph() const;
+
+    // Write this graph in the binary CSR format
+    void save(const char* path) const;
+
+    // Write an adjacency list graph in the binary CSR format without building a CSRGraph
+    static void save(const Graph& g, const char* path);
+
+    // Full structural check (offsets non-decreasing, targets in range);
+    // throws "Invalid graph file" on the first violation
+    void validate() const;
+
+    // Whether the arrays live in a mapped file
+    bool isMapped() const { return mapping != nullptr; }
+
+    // Entry range of v's neighbors: [begin(v), end(v))
+    int begin(int v) const { return offsets[v]; }
+    int end(int v) const { return offsets[v + 1]; }
+
+    // Neighbor vertex and edge weight of entry i
+    int target(int i) const { return targets[i]; }
+    int weight(int i) const { return weights[i]; }
+};
+
+}
@@ -0,0 +1,45 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include <atomic>
+
+namespace graph {
+
+/*
+Lock-free Disjoint Set Union for many threads at once.
+Every operation may run concurrently with any other.
+
+- find uses path splitting: each visited node is pointed at its
+  grandparent with a compare-and-swap, which never breaks a tree.
+- unite links by index: the root with the smaller index is CAS-ed under
+  the one with the larger index, so links always go "up" and cannot
+  form a cycle. A failed CAS means another thread changed that root;
+  the operation retries from the new roots.
+*/
+class ConcurrentUnionFind {
+private:
+    std::atomic<int>* parent; // parent[i] = parent of node i
+    int size;                 // total number of elements
+
+public:
+    // Constructor: initializes n disjoint sets (0 to n-1)
+    ConcurrentUnionFind(int size);
+
+    // Destructor: free internal array
+    ~ConcurrentUnionFind();
+
+    ConcurrentUnionFind(const ConcurrentUnionFind&) = delete;
+    ConcurrentUnionFind& operator=(const ConcurrentUnionFind&) = delete;
+
+    // Find the current root of the set containing x
+    int find(int x);
+
+    // Merge sets containing x and y; returns false if they were already joined
+    bool unite(int x, int y);
+
+    // Check if x and y are in the same set (linearizable)
+    bool connected(int x, int y);
+};
+
+}
@@ -0,0 +1,160 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include <limits>
+
+namespace graph {
+
+/*
+D-ary min-heap priority queue for (vertex, distance) pairs, with the same
+interface as PriorityQueue. Every node has D children, so the heap is
+log_D(n) deep: decrease-key (heapifyUp) gets cheaper as D grows, while
+extractMin compares more children per level. The children of a node are
+adjacent in memory, so a 4- or 8-ary level is usually one cache line.
+
+Vertex IDs must be in [0, capacity). As in PriorityQueue, construction
+only zeroes the position map and clear() costs O(size). VertexT and KeyT
+default to int; the generic graph algorithms use wider ids and
+float/double keys.
+*/
+template <int D, typename VertexT = int, typename KeyT = int>
+class DaryPriorityQueue {
+    static_assert(D >= 2, "DaryPriorityQueue needs at least two children per node");
+
+private:
+    VertexT* vertices;     // stores vertex IDs
+    KeyT* distances;       // stores their current priority (distance)
+    VertexT* position;     // position[v] = heap slot of vertex v plus one, 0 if absent
+    VertexT size;          // current number of elements
+    VertexT capacity;      // maximum size of the heap
+
+    // Place (vertex, distance) at slot i
+    void place(VertexT i, VertexT vertex, KeyT distance) {
+        vertices[i] = vertex;
+        distances[i] = distance;
+        position[vertex] = i + 1;
+    }
+
+    // Restore heap order from a node upward (moves a hole instead of swapping)
+    void heapifyUp(VertexT index) {
+        VertexT vertex = vertices[index];
+        KeyT distance = distances[index];
+        while (index > 0) {
+            VertexT parent = (index - 1) / D;
+            if (distance >= distances[parent]) break;
+            place(index, vertices[parent], distances[parent]);
+            index = parent;
+        }
+        place(index, vertex, distance);
+    }
+
+    // Restore heap order from a node downward
+    void heapifyDown(VertexT index) {
+        VertexT vertex = vertices[index];
+        KeyT distance = distances[index];
+        while (true) {
+            VertexT first = D * index + 1;
+            if (first >= size) break;
+            VertexT last = first + D < size ? first + D : size;
+
+            VertexT smallest = first;
+            for (VertexT c = first + 1; c < last; ++c)
+                if (distances[c] < distances[smallest])
+                    smallest = c;
+
+            if (distances[smallest] >= distance) break;
+            place(index, vertices[smallest], distances[smallest]);
+            index = smallest;
+        }
+        place(index, vertex, distance);
+    }
+
+public:
+    // Constructor / Destructor
+    DaryPriorityQueue(VertexT capacity) : size(0), capacity(capacity) {
+        vertices = new VertexT[capacity];
+        distances = new KeyT[capacity];
+        position = new VertexT[capacity](); // 0: not in the heap
+    }
+
+    ~DaryPriorityQueue() {
+        delete[] vertices;
+        delete[] distances;
+        delete[] position;
+    }
+
+    DaryPriorityQueue(const DaryPriorityQueue&) = delete;
+    DaryPriorityQueue& operator=(const DaryPriorityQueue&) = delete;
+
+    // Returns true if queue is empty
+    bool isEmpty() const { return size == 0; }
+
+    // Insert a (vertex, distance) pair into the queue
+    void insert(VertexT vertex, KeyT distance) {
+        if (vertex < 0 || vertex >= capacity)
+            throw "Vertex out of range";
+        if (position[vertex] != 0)
+            throw "Vertex already in heap";
+        place(size, vertex, distance);
+        ++size;
+        heapifyUp(size - 1);
+    }
+
+    // Remove and return the vertex with the smallest distance
+    VertexT extractMin() {
+        if (isEmpty())
+            throw "Heap is empty";
+
+        VertexT minVertex = vertices[0];
+        position[minVertex] = 0;
+
+        --size;
+        if (size > 0) {
+            place(0, vertices[size], distances[size]);
+            heapifyDown(0);
+        }
+        return minVertex;
+    }
+
+    // Smallest distance in the queue, without removing it
+    KeyT minDistance() const {
+        if (isEmpty())
+            throw "Heap is empty";
+        return distances[0];
+    }
+
+    // Check if queue currently contains this vertex
+    bool contains(VertexT vertex) const {
+        return vertex >= 0 && vertex < capacity && position[vertex] != 0;
+    }
+
+    // Get the stored distance for a vertex (if found)
+    KeyT getDistance(VertexT vertex) const {
+        if (!contains(vertex))
+            return std::numeric_limits<KeyT>::max(); // default "infinite"
+        return distances[position[vertex] - 1];
+    }
+
+    // Update the distance of a vertex (if it exists in the queue)
+    void updateDistance(VertexT vertex, KeyT newDist) {
+        if (!contains(vertex)) return;
+
+        VertexT i = position[vertex] - 1;
+        KeyT oldDist = distances[i];
+        distances[i] = newDist;
+        if (newDist < oldDist)
+            heapifyUp(i);
+        else
+            heapifyDown(i);
+    }
+
+    // Remove every vertex, in O(size)
+    void clear() {
+        for (VertexT i = 0; i < size; ++i)
+            position[vertices[i]] = 0;
+        size = 0;
+    }
+};
+
+}
@@ -0,0 +1,80 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+namespace graph {
+
+/*
+Offline dynamic connectivity:
+record a log of edge insertions, edge deletions and "are u and v
+connected?" queries, then answer every query at once with solve().
+
+Each operation takes one time step. An edge copy lives over the time
+interval between its insertion and its deletion (or the end of the log);
+the interval is stored in the O(log T) nodes of a segment tree over time
+that cover it. A DFS over the tree unites the edges of each node on a
+RollbackUnionFind and undoes them on the way back, so at leaf t exactly
+the edges alive at time t are united. Total cost O((M log T + Q) log n).
+
+Parallel edges are counted: u-v stays present until every copy is removed.
+Live copies are counted as operations are recorded, so an invalid
+removal is rejected right away and the log stays solvable.
+*/
+class DynamicConnectivity {
+private:
+    enum class OpType { Add, Remove, Query };
+
+    struct Operation {
+        OpType type;
+        int u, v;    // endpoints, stored with u <= v
+    };
+
+    // Live copies of edge u-v (u <= v) in an open-addressing table
+    struct EdgeCount {
+        int u, v;
+        int count;
+        bool used;
+    };
+
+    int numVertices;
+    Operation* log;   // operations in time order
+    int logSize;
+    int logCapacity;
+    int numQueries;
+    bool* answers;    // answers[q] for the q-th query, after solve()
+    EdgeCount* counts;
+    int countCapacity; // power of two, at most half full
+    int countSize;
+
+    int append(OpType type, int u, int v);
+    int probe(int u, int v) const; // slot holding u-v, or the free slot it would take
+    int& liveCopies(int u, int v); // count slot of u-v, created at 0
+    int* findCopies(int u, int v); // count slot of u-v, nullptr if it has none
+    void validateVertex(int v) const;
+
+public:
+    DynamicConnectivity(int numVertices);
+    ~DynamicConnectivity();
+
+    DynamicConnectivity(const DynamicConnectivity&) = delete;
+    DynamicConnectivity& operator=(const DynamicConnectivity&) = delete;
+
+    // Insert a copy of the undirected edge u-v
+    void addEdge(int u, int v);
+
+    // Delete one copy of u-v; throws (and logs nothing) if no copy is present
+    void removeEdge(int u, int v);
+
+    // Ask whether u and v are connected at this point of the log; returns the query id
+    int query(int u, int v);
+
+    // Answer every recorded query
+    void solve();
+
+    // Answer of query id (after solve)
+    bool answer(int queryId) const;
+
+    int getNumQueries() const;
+};
+
+}
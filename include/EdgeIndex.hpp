@@ -0,0 +1,63 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include "Graph.hpp"
+
+namespace graph {
+
+/*
+Hash index over the adjacency lists of a Graph, keyed by (u, v).
+
+The entry of (u, v) stores the link that points at the front-most node
+for v in u's list - &adjList[u] or &prev->next - so the node can be read,
+updated or unlinked in O(1) without walking the list. Parallel edges share
+one entry with a count; only the front-most copy is addressed, the same
+one a list scan would find first.
+
+Open addressing with linear probing and backward-shift deletion (no
+tombstones); the table doubles to stay at most half full.
+*/
+template <typename VertexT, typename WeightT>
+class BasicEdgeIndex {
+public:
+    typedef BasicNeighbor<VertexT, WeightT> Neighbor;
+
+    struct Entry {
+        VertexT u, v;     // key
+        Neighbor** link;  // link pointing at the front-most u -> v node
+        int count;        // number of u -> v nodes in u's list
+    };
+
+private:
+    Entry* table;
+    bool* used;       // used[i] = slot i holds an entry
+    size_t capacity;  // power of two
+    size_t size;      // occupied slots
+
+    size_t slotOf(VertexT u, VertexT v) const;
+    void grow();
+
+public:
+    BasicEdgeIndex(size_t expectedEntries = 0);
+    ~BasicEdgeIndex();
+
+    BasicEdgeIndex(const BasicEdgeIndex&) = delete;
+    BasicEdgeIndex& operator=(const BasicEdgeIndex&) = delete;
+
+    // Entry of (u, v), or nullptr
+    Entry* find(VertexT u, VertexT v) const;
+
+    // Entry of (u, v), created with count 0 and no link if missing.
+    // The pointer is valid until the next findOrAdd or erase.
+    Entry* findOrAdd(VertexT u, VertexT v);
+
+    // Remove the entry of (u, v) if present
+    void erase(VertexT u, VertexT v);
+
+    size_t getSize() const;
+};
+
+typedef BasicEdgeIndex<int, int> EdgeIndex;
+
+}
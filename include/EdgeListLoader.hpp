@@ -0,0 +1,38 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include "Graph.hpp"
+#include "CSRGraph.hpp"
+
+namespace graph {
+
+/*
+Text edge-list loading.
+
+The input holds one "u v w" triple per line, separated by spaces or tabs;
+text from '#' to the end of a line is a comment and blank lines are skipped. Vertex IDs are
+non-negative and the vertex count is the largest ID plus one. Weights may
+be negative.
+
+The file is mapped read-only and split into one chunk per thread at line
+boundaries. Every thread parses its chunk with a hand-written integer
+scanner into a private edge buffer. parseEdgeList concatenates the buffers
+in file order; loadEdgeList counts degrees and scatters into the CSR
+straight from them. Either way the result equals calling addEdge for every
+line in turn.
+
+Throws "Invalid edge list" on malformed input and "Failed to open edge
+list" if the file cannot be read. When errorLine is given it receives the
+1-based number of the first malformed line, or 0 if the failure is not
+tied to a line (unreadable file, too many edges or vertices).
+*/
+
+// Parse an edge list into a newly allocated Edge array (caller deletes[] it)
+Edge* parseEdgeList(const char* path, int& numVertices, int& edgeCount, int numThreads = 0,
+                    long long* errorLine = nullptr);
+
+// Parse an edge list and build its CSR graph
+CSRGraph loadEdgeList(const char* path, int numThreads = 0, long long* errorLine = nullptr);
+
+}
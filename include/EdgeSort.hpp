@@ -0,0 +1,33 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include "Graph.hpp"
+
+namespace graph {
+
+// Total order on edges: by weight, then by endpoints.
+// Edges equal under it are interchangeable in every MST algorithm.
+inline bool edgeLess(const Edge& a, const Edge& b) {
+    if (a.weight != b.weight) return a.weight < b.weight;
+    if (a.u != b.u) return a.u < b.u;
+    return a.v < b.v;
+}
+
+// Stable merge sort of arr[left..right] by edge weight
+void mergeSort(Edge* arr, int left, int right);
+
+// In-place, allocation-free sort of edges[0..count) by edgeLess
+// (introsort: quicksort, heapsort past a depth limit, insertion sort for short ranges)
+void sortEdges(Edge* edges, int count);
+
+// Parallel, stable LSD radix sort of edges[0..count) by weight, 8 bits per
+// pass; passes over bytes that are equal in every key are skipped.
+// numThreads = 0 uses one thread per core. Needs a count-sized buffer.
+void radixSortEdges(Edge* edges, int count, int numThreads = 0);
+
+// Parallel radix sort of edges[0..count) into edgeLess order
+// (v, then u, then weight passes, each stable)
+void radixSortEdgesTotal(Edge* edges, int count, int numThreads = 0);
+
+}
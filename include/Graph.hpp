@@ -2,30 +2,184 @@
 
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+
 namespace graph{
-  struct Neighbor{
-    int vertex; //Neighbor vertex
-    int weight; //edge weight
-    Neighbor* next;  //pointer to next neighbor
+  /*
+  Every graph type is a template over the vertex id type and the edge
+  weight type, so one dataset can use 64-bit ids and another float weights
+  without paying for the widest representation everywhere. The int/int
+  versions keep their old names (Graph, Neighbor, Edge, ...).
+
+  Code for these pairs is compiled into the library (see
+  GRAPH_FOR_EACH_TYPE_PAIR); other pairs fail to link.
+  */
+
+  //Expands F(VertexT, WeightT) for every compiled vertex/weight pair
+  #define GRAPH_FOR_EACH_TYPE_PAIR(F) \
+    F(int, int)                       \
+    F(int, unsigned short)            \
+    F(int, float)                     \
+    F(int, double)                    \
+    F(long long, int)                 \
+    F(long long, double)
+
+  template <typename VertexT, typename WeightT>
+  struct BasicNeighbor{
+    VertexT vertex; //Neighbor vertex
+    WeightT weight; //edge weight
+    BasicNeighbor* next;  //pointer to next neighbor
+
+    BasicNeighbor(VertexT vertex, WeightT weight, BasicNeighbor* next = nullptr) : vertex(vertex), weight(weight), next(next) {};
+  };
 
-    Neighbor(int vertex, int weight, Neighbor* next = nullptr) : vertex(vertex), weight(weight), next(next) {};
+  template <typename VertexT, typename WeightT>
+  struct BasicEdge{
+    VertexT u, v;   //edge endpoints
+    WeightT weight; //edge weight
   };
 
-  class Graph{
+  //Arena of Neighbor nodes: nodes are carved out of chunked blocks and the
+  //whole arena is released at once, instead of one new/delete per node.
+  //Removed nodes go to a free list and are reused by later allocations.
+  template <typename VertexT, typename WeightT>
+  class BasicNeighborPool{
+  public:
+    typedef BasicNeighbor<VertexT, WeightT> Neighbor;
+
   private:
-    int numVertices;
+    struct Block{
+      Neighbor* nodes; //raw storage for capacity nodes
+      size_t capacity;
+      size_t used;
+      Block* next;     //previously filled block
+    };
+
+    Block* blocks;     //most recent block first
+    Neighbor* freeList;//released nodes, linked through Neighbor::next
+    size_t nextCapacity;  //capacity of the next block to allocate
+
+    void release();
+  public:
+    BasicNeighborPool();
+    ~BasicNeighborPool();
+
+    BasicNeighborPool(const BasicNeighborPool&) = delete;
+    BasicNeighborPool& operator=(const BasicNeighborPool&) = delete;
+    BasicNeighborPool(BasicNeighborPool&& other) noexcept;
+    BasicNeighborPool& operator=(BasicNeighborPool&& other) noexcept;
+
+    Neighbor* allocate(VertexT vertex, WeightT weight, Neighbor* next);
+    void deallocate(Neighbor* node);
+
+    //Uninitialized storage for count contiguous nodes, in a block of its own
+    Neighbor* allocateRun(size_t count);
+  };
+
+  template <typename VertexT, typename WeightT> class BasicEdgeIndex;
+
+  //Type of path lengths: small integer weights add up in int, but a graph
+  //with 64-bit ids (or weights) can have paths too long for 32 bits, so
+  //integer sums are widened to long long there
+  template <typename VertexT, typename WeightT>
+  struct PathLength{
+    typedef decltype(WeightT() + WeightT()) Sum;
+    typedef typename std::conditional<std::is_integral<Sum>::value && sizeof(Sum) < 8 &&
+                                          (sizeof(VertexT) >= 8 || sizeof(WeightT) >= 8),
+                                      long long, Sum>::type type;
+  };
+
+  //Undirected by default: addEdge(u, v) links u to v and v to u. A directed
+  //graph keeps out-neighbors only (half the nodes); in-neighbors are found
+  //in its transpose().
+  template <typename VertexT, typename WeightT>
+  class BasicGraph{
+  public:
+    typedef VertexT VertexType;
+    typedef WeightT WeightType;
+    typedef typename PathLength<VertexT, WeightT>::type DistanceType;
+    typedef BasicNeighbor<VertexT, WeightT> Neighbor;
+    typedef BasicEdge<VertexT, WeightT> Edge;
+    typedef BasicEdgeIndex<VertexT, WeightT> EdgeIndex;
+
+  private:
+    VertexT numVertices;
+    bool directed;
     Neighbor** adjList;
+    BasicNeighborPool<VertexT, WeightT> pool; //owns every Neighbor in adjList
+    EdgeIndex* index;  //optional (u, v) -> node lookup, nullptr when disabled
+
+    void removeNeighbor(Neighbor* &head, VertexT v);
+    Neighbor** findLink(VertexT u, VertexT v) const;
+    void indexFront(VertexT u);
+    void unlinkIndexed(VertexT u, VertexT v);
   public:
-    Graph(int numVertices); //constructor
-    ~Graph(); //destructor
+    BasicGraph(VertexT numVertices, bool directed = false); //constructor
+    ~BasicGraph(); //destructor
+
+    //Graphs own their nodes: they can be moved but not copied
+    BasicGraph(const BasicGraph&) = delete;
+    BasicGraph& operator=(const BasicGraph&) = delete;
+    BasicGraph(BasicGraph&& other) noexcept;
+    BasicGraph& operator=(BasicGraph&& other) noexcept;
+
+    void validateVertex(VertexT v) const;
+    void addEdge(VertexT src, VertexT dest, WeightT weight);
+    //Add count edges at once; same lists as calling addEdge for each edge in order
+    void addEdges(const Edge* edges, size_t count);
+    void removeEdge(VertexT src, VertexT dest);
+    bool hasEdge(VertexT src, VertexT dest) const;
+    WeightT getWeight(VertexT src, VertexT dest) const;
+    void updateWeight(VertexT src, VertexT dest, WeightT weight);
+
+    //Optional hash index: O(1) expected hasEdge, getWeight, updateWeight and
+    //removeEdge, at the cost of one table entry per (u, v) pair
+    void enableEdgeIndex();
+    void disableEdgeIndex();
+    bool hasEdgeIndex() const;
 
-    
-    void validateVertex(int v) const;
-    void addEdge(int src, int dest, int weight);
-    void removeEdge(int src, int dest);
     void printGraph()const;
-    int getNumVertices()const;
-    Neighbor* getNeighbors(int vertex)const;
+    VertexT getNumVertices()const;
+    bool isDirected()const;
+    Neighbor* getNeighbors(VertexT vertex)const;
+    //Directed graph with every edge reversed (out-lists become in-lists)
+    BasicGraph transpose()const;
+  };
+
+  //Collects edges and builds the Graph with a single addEdges call
+  template <typename VertexT, typename WeightT>
+  class BasicGraphBuilder{
+  public:
+    typedef BasicEdge<VertexT, WeightT> Edge;
+
+  private:
+    VertexT numVertices;
+    bool directed;
+    Edge* edges;
+    size_t count;
+    size_t capacity;
+
+    void grow(size_t minCapacity);
+  public:
+    BasicGraphBuilder(VertexT numVertices, bool directed = false);
+    ~BasicGraphBuilder();
+
+    BasicGraphBuilder(const BasicGraphBuilder&) = delete;
+    BasicGraphBuilder& operator=(const BasicGraphBuilder&) = delete;
+
+    void reserve(size_t edgeCount);
+    void addEdge(VertexT src, VertexT dest, WeightT weight);
+    size_t getNumEdges() const;
+    //Build the graph; the builder keeps its edges and can build again
+    BasicGraph<VertexT, WeightT> build() const;
   };
-  
+
+  //Default representation: int vertex ids and int weights
+  typedef BasicNeighbor<int, int> Neighbor;
+  typedef BasicEdge<int, int> Edge;
+  typedef BasicNeighborPool<int, int> NeighborPool;
+  typedef BasicGraph<int, int> Graph;
+  typedef BasicGraphBuilder<int, int> GraphBuilder;
+
 }
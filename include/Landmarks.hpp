@@ -0,0 +1,102 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include "Graph.hpp"
+#include "CSRGraph.hpp"
+#include "Results.hpp"
+#include "SearchWorkspace.hpp"
+
+namespace graph {
+
+// How LandmarkIndex picks its landmarks
+enum class LandmarkSelection {
+    Farthest, // each landmark is the vertex farthest from the ones chosen so far
+    Avoid     // leaf of the shortest path subtree that current bounds cover worst
+};
+
+/*
+ALT (A*, Landmarks, Triangle inequality) index for undirected graphs.
+
+For a few landmarks L the distances d(L, v) to every vertex are computed
+once with Dijkstra. By the triangle inequality
+
+    d(v, t) >= |d(L, t) - d(L, v)|
+
+for every landmark, and the largest of these bounds is a consistent A*
+heuristic: pass the index to Algorithms::astar, or call shortestPath.
+
+The distances are stored vertex by vertex (the k landmark distances of a
+vertex are adjacent), so one bound reads two short contiguous runs.
+Memory is 4 * numVertices * numLandmarks bytes. The index matches the
+graph it was built from; edge changes that shorten paths invalidate it.
+
+File format (version 1, native byte order, 40-byte header):
+    char     magic[8]        "GRAPHALT"
+    uint32   version         1
+    uint32   byteOrder       0x01020304 as written by the saving machine
+    int64    numVertices
+    int64    numLandmarks
+    uint64   reserved        0
+    int32    landmarks[numLandmarks]
+    int32    distances[numVertices * numLandmarks]   INT_MAX if unreachable
+*/
+class LandmarkIndex {
+private:
+    int numVertices;
+    int numLandmarks;
+    int* landmarks;   // landmark vertices, in selection order
+    int* distances;   // distances[v * numLandmarks + i] = d(landmarks[i], v)
+
+    template <typename G>
+    void build(const G& g, int count, LandmarkSelection selection);
+
+public:
+    // Select up to count landmarks (at most one per vertex) and compute their distances
+    LandmarkIndex(const Graph& g, int count, LandmarkSelection selection = LandmarkSelection::Avoid);
+    LandmarkIndex(const CSRGraph& g, int count, LandmarkSelection selection = LandmarkSelection::Avoid);
+
+    // Load an index written by save()
+    explicit LandmarkIndex(const char* path);
+
+    ~LandmarkIndex();
+
+    LandmarkIndex(const LandmarkIndex&) = delete;
+    LandmarkIndex& operator=(const LandmarkIndex&) = delete;
+    LandmarkIndex(LandmarkIndex&& other) noexcept;
+    LandmarkIndex& operator=(LandmarkIndex&& other) noexcept;
+
+    void save(const char* path) const;
+
+    int getNumVertices() const { return numVertices; }
+    int getNumLandmarks() const { return numLandmarks; }
+    int landmark(int i) const { return landmarks[i]; }
+    int distance(int i, int v) const { return distances[(size_t)v * numLandmarks + i]; }
+
+    // Largest landmark lower bound on d(v, target); 0 when no landmark reaches both
+    int lowerBound(int v, int target) const {
+        const int* fromV = distances + (size_t)v * numLandmarks;
+        const int* fromTarget = distances + (size_t)target * numLandmarks;
+        int best = 0;
+        for (int i = 0; i < numLandmarks; ++i) {
+            if (fromV[i] == INT_MAX || fromTarget[i] == INT_MAX) continue;
+            int bound = fromV[i] > fromTarget[i] ? fromV[i] - fromTarget[i] : fromTarget[i] - fromV[i];
+            if (bound > best) best = bound;
+        }
+        return best;
+    }
+
+    // A* heuristic interface
+    int operator()(int v, int target) const { return lowerBound(v, target); }
+
+    // A* from source to target with the landmark bounds; g must be the indexed graph.
+    // A workspace reused across queries saves the O(n) setup of each one.
+    PathResult shortestPath(const Graph& g, int source, int target) const;
+    PathResult shortestPath(const CSRGraph& g, int source, int target) const;
+    PathResult shortestPath(const Graph& g, int source, int target, SearchWorkspace& workspace) const;
+    PathResult shortestPath(const CSRGraph& g, int source, int target, SearchWorkspace& workspace) const;
+};
+
+}
@@ -0,0 +1,58 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace graph {
+
+// Number of worker threads to use: requested if positive, else one per core
+int resolveThreadCount(int requested);
+
+// Reusable barrier: wait() blocks until count threads have called it
+class Barrier {
+private:
+    std::mutex mutex;
+    std::condition_variable released;
+    int count;        // threads taking part
+    int waiting;      // threads arrived in the current round
+    int generation;   // incremented whenever a round completes
+
+public:
+    Barrier(int count);
+
+    Barrier(const Barrier&) = delete;
+    Barrier& operator=(const Barrier&) = delete;
+
+    void wait();
+};
+
+// Run invoke(context, threadId) for threadId in [0, numThreads), see runParallel
+void runOnPool(int numThreads, void (*invoke)(void*, int), void* context);
+
+/*
+Run body(threadId) for threadId in [0, numThreads) and wait for all of them.
+The calling thread runs threadId 0 itself.
+
+The other ids run on a process-wide pool of parked worker threads, grown
+on demand and reused by every call, so a parallel level, radix pass or
+Boruvka round pays a wake-up instead of a thread creation. All numThreads
+bodies run at the same time, so they may synchronize with a Barrier. A
+call made while the pool is busy (from inside a body, or from another
+thread) falls back to threads of its own.
+*/
+template <typename F>
+void runParallel(int numThreads, F&& body) {
+    if (numThreads <= 1) {
+        body(0);
+        return;
+    }
+    typedef typename std::remove_reference<F>::type Body;
+    runOnPool(numThreads, [](void* context, int t) { (*static_cast<Body*>(context))(t); },
+              (void*)&body);
+}
+
+}
@@ -4,16 +4,21 @@
 
 namespace graph {
 
-// A manual min-heap based priority queue for (vertex, distance) pairs
+// A manual min-heap based priority queue for (vertex, distance) pairs.
+// Vertex IDs must be in [0, capacity); a position map from vertex to heap
+// slot makes contains/getDistance O(1) and updateDistance O(log n).
+// Construction only zeroes the position map, and clear() touches just the
+// queued vertices, so one queue can serve many short searches.
 class PriorityQueue {
 private:
     int* vertices;     // stores vertex IDs
     int* distances;    // stores their current priority (distance)
+    int* position;     // position[v] = heap slot of vertex v plus one, 0 if absent
     int size;          // current number of elements
     int capacity;      // maximum size of the heap
 
     // Internal helpers to maintain heap order
-    void swap(int i, int j);            // swaps two elements
+    void swap(int i, int j);            // swaps two elements (and their positions)
     void heapifyUp(int index);          // restore heap from bottom up
     void heapifyDown(int index);        // restore heap from top down
 
@@ -31,6 +36,9 @@ public:
     // Remove and return the vertex with the smallest distance
     int extractMin();
 
+    // Smallest distance in the queue, without removing it
+    int minDistance() const;
+
     // Check if queue currently contains this vertex
     bool contains(int vertex) const;
 
@@ -39,6 +47,9 @@ public:
 
     // Update the distance of a vertex (if it exists in the queue)
     void updateDistance(int vertex, int newDist);
+
+    // Remove every vertex, in O(size)
+    void clear();
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,87 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+namespace graph {
+
+/*
+Plain array results of the traversal and shortest path algorithms, for
+callers that need distances and predecessors but not a materialized tree.
+Results own their arrays: they can be moved but not copied.
+*/
+
+// Single-source shortest paths; DistanceT is the path length type of the graph
+template <typename VertexT, typename DistanceT>
+struct BasicShortestPathResult {
+    VertexT numVertices;
+    VertexT source;
+    DistanceT* dist;  // dist[v] = shortest distance from source, max() of DistanceT if unreachable
+    VertexT* parent;  // parent[v] = predecessor on a shortest path, -1 for source/unreachable
+
+    BasicShortestPathResult(VertexT numVertices, VertexT source);
+    ~BasicShortestPathResult();
+
+    BasicShortestPathResult(const BasicShortestPathResult&) = delete;
+    BasicShortestPathResult& operator=(const BasicShortestPathResult&) = delete;
+    BasicShortestPathResult(BasicShortestPathResult&& other) noexcept;
+    BasicShortestPathResult& operator=(BasicShortestPathResult&& other) noexcept;
+
+    bool reachable(VertexT v) const;
+};
+
+// BFS / DFS traversal from a single source
+template <typename VertexT>
+struct BasicTraversalResult {
+    VertexT numVertices;
+    VertexT source;
+    VertexT visitedCount;   // number of reached vertices (valid prefix of order)
+    VertexT* order;         // vertices in visiting order
+    VertexT* parent;        // parent[v] in the traversal tree, -1 for source/unreached
+    VertexT* depth;         // depth[v] = tree depth (edges from source), -1 if unreached
+    VertexT* discovery;     // DFS only, optional: time v was discovered, -1 if unreached
+    VertexT* finish;        // DFS only, optional: time v was finished, -1 if unreached
+
+    BasicTraversalResult(VertexT numVertices, VertexT source);
+    ~BasicTraversalResult();
+
+    BasicTraversalResult(const BasicTraversalResult&) = delete;
+    BasicTraversalResult& operator=(const BasicTraversalResult&) = delete;
+    BasicTraversalResult(BasicTraversalResult&& other) noexcept;
+    BasicTraversalResult& operator=(BasicTraversalResult&& other) noexcept;
+
+    bool visited(VertexT v) const;
+    bool hasTimestamps() const;
+    void enableTimestamps(); // allocate discovery/finish, all -1
+};
+
+// Single source-target shortest path
+template <typename VertexT, typename DistanceT>
+struct BasicPathResult {
+    VertexT source;
+    VertexT target;
+    DistanceT cost;   // path length, max() of DistanceT if target is unreachable
+    VertexT length;   // number of vertices on the path, 0 if target is unreachable
+    VertexT* path;    // path[0] = source, ..., path[length - 1] = target
+    VertexT settled;  // vertices the search settled before it stopped (forward side if bidirectional)
+    VertexT settledBackward; // vertices the backward search settled, 0 for one-sided searches
+
+    BasicPathResult(VertexT source, VertexT target);
+    ~BasicPathResult();
+
+    BasicPathResult(const BasicPathResult&) = delete;
+    BasicPathResult& operator=(const BasicPathResult&) = delete;
+    BasicPathResult(BasicPathResult&& other) noexcept;
+    BasicPathResult& operator=(BasicPathResult&& other) noexcept;
+
+    bool found() const;
+    // Store the path that ends at target, following parent[] back to source
+    void tracePath(const VertexT* parent, DistanceT pathCost);
+    // Store source -> meet along parent, then meet -> target along backwardParent
+    void tracePath(const VertexT* parent, VertexT meet, const VertexT* backwardParent, DistanceT pathCost);
+};
+
+typedef BasicShortestPathResult<int, int> ShortestPathResult;
+typedef BasicTraversalResult<int> TraversalResult;
+typedef BasicPathResult<int, int> PathResult;
+
+}
@@ -0,0 +1,59 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+namespace graph {
+
+/*
+Disjoint Set Union with undo: union by rank and no path compression, so
+every unite changes at most two fields, which are recorded on an undo
+stack. find is O(log n).
+
+    int mark = uf.snapshot();
+    uf.unite(a, b); ...
+    uf.rollback(mark);   // back to the state at snapshot()
+*/
+class RollbackUnionFind {
+private:
+    // One undo record per successful unite
+    struct Change {
+        int child;       // root that was attached
+        int root;        // root it was attached under
+        bool rankGrew;   // whether rank[root] was incremented
+    };
+
+    int* parent;     // parent[i] = parent of node i
+    int* rank;       // rank[i] = height bound of the tree rooted at i
+    Change* history; // undo stack
+    int historySize;
+    int size;        // total number of elements
+    int sets;        // current number of disjoint sets
+
+public:
+    // Constructor: initializes n disjoint sets (0 to n-1)
+    RollbackUnionFind(int size);
+    ~RollbackUnionFind();
+
+    RollbackUnionFind(const RollbackUnionFind&) = delete;
+    RollbackUnionFind& operator=(const RollbackUnionFind&) = delete;
+
+    // Find the root of the set containing x (no compression)
+    int find(int x) const;
+
+    // Merge sets containing x and y; returns false if they were already joined
+    bool unite(int x, int y);
+
+    // Check if x and y are in the same set
+    bool connected(int x, int y) const;
+
+    // Current number of disjoint sets
+    int numSets() const;
+
+    // Marker for the current state
+    int snapshot() const;
+
+    // Undo every unite made after snapshot() returned mark
+    void rollback(int mark);
+};
+
+}
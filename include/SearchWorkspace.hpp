@@ -0,0 +1,96 @@
+// Author: realyoavperetz@gmail.com
+
+#pragma once
+
+#include <limits>
+#include "PriorityQueue.hpp"
+#include "DaryPriorityQueue.hpp"
+
+namespace graph {
+
+/*
+Reusable storage for point-to-point searches (shortestPath, astar,
+LandmarkIndex::shortestPath, and one per side of bidirectionalDijkstra):
+distances, parents and a heap for up to numVertices vertices, allocated
+once.
+
+Every vertex a query reaches is stamped with the query's generation
+(generation + 1 once it is settled); vertices with an older stamp read
+as unreached. Starting a query advances the generation and clears only
+the vertices still queued, so a query costs time in the part of the
+graph it explores, not O(n). Stamps are zeroed again only when the
+generation counter wraps around.
+
+A workspace serves one query at a time; keep one per thread.
+*/
+template <typename V = int, typename D = int, typename PQ = DaryPriorityQueue<4, V, D>>
+class BasicSearchWorkspace {
+private:
+    V numVertices;
+    D* dist;              // valid only where stamp[v] == generation
+    V* parent;            // valid only where stamp[v] == generation
+    unsigned* stamp;      // generation (+ 1 if settled) of the last query that reached v
+    unsigned generation;  // even; 0 before the first query
+    PQ pq;
+
+public:
+    explicit BasicSearchWorkspace(V numVertices)
+        : numVertices(numVertices), generation(0), pq(numVertices) {
+        dist = new D[numVertices];
+        parent = new V[numVertices];
+        stamp = new unsigned[numVertices]();
+    }
+
+    ~BasicSearchWorkspace() {
+        delete[] dist;
+        delete[] parent;
+        delete[] stamp;
+    }
+
+    BasicSearchWorkspace(const BasicSearchWorkspace&) = delete;
+    BasicSearchWorkspace& operator=(const BasicSearchWorkspace&) = delete;
+
+    V getNumVertices() const { return numVertices; }
+
+    // Forget the previous query: every vertex becomes unreached, the heap empty
+    void reset() {
+        pq.clear();
+        generation += 2;
+        if (generation == 0) {
+            for (V v = 0; v < numVertices; ++v)
+                stamp[v] = 0;
+            generation = 2;
+        }
+    }
+
+    bool reached(V v) const { return stamp[v] - generation <= 1; }
+    bool settled(V v) const { return stamp[v] == generation + 1; }
+
+    // Distance found so far, max() of D if v is unreached
+    D distance(V v) const { return reached(v) ? dist[v] : std::numeric_limits<D>::max(); }
+
+    // Record a (shorter) distance and parent for v
+    void reach(V v, D distance, V from) {
+        if (!reached(v)) stamp[v] = generation;
+        dist[v] = distance;
+        parent[v] = from;
+    }
+
+    // Mark a reached vertex settled; false if it already was in this query
+    bool settle(V v) {
+        bool first = !settled(v);
+        stamp[v] = generation + 1;
+        return first;
+    }
+
+    // Parent array for tracing a path; only entries of reached vertices are valid
+    const V* parents() const { return parent; }
+
+    PQ& queue() { return pq; }
+    const PQ& queue() const { return pq; }
+};
+
+// Workspace of the int-weighted Graph and CSRGraph queries
+typedef BasicSearchWorkspace<int, int, PriorityQueue> SearchWorkspace;
+
+}
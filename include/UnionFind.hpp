@@ -4,20 +4,37 @@
 
 namespace graph {
 
-// Disjoint Set Union (Union-Find) with path compression and union by rank
+// Disjoint Set Union (Union-Find) with path halving and union by rank or by size
 class UnionFind {
+public:
+    // How unite picks the new root
+    enum class Strategy {
+        ByRank,  // attach the shallower tree under the deeper one
+        BySize   // attach the smaller set under the larger one (enables setSize)
+    };
+
 private:
-    int* parent; // parent[i] = parent of node i
-    int* rank;   // rank[i] = depth estimate of the tree rooted at i
-    int size;    // total number of elements
+    // parent and rank/size side by side: one cache line holds both
+    struct Node {
+        int parent;  // parent of the node (itself for a root)
+        int weight;  // roots only: rank (ByRank) or set size (BySize)
+    };
+
+    Node* nodes;
+    int size;        // total number of elements
+    int sets;        // current number of disjoint sets
+    Strategy strategy;
 
 public:
     // Constructor: initializes n disjoint sets (0 to n-1)
-    UnionFind(int size);
+    UnionFind(int size, Strategy strategy = Strategy::ByRank);
 
     // Destructor: free internal arrays
     ~UnionFind();
 
+    UnionFind(const UnionFind&) = delete;
+    UnionFind& operator=(const UnionFind&) = delete;
+
     // Find the root of the set containing x
     int find(int x);
 
@@ -26,6 +43,12 @@ public:
 
     // Check if x and y are in the same set
     bool connected(int x, int y);
+
+    // Number of elements in the set containing x (Strategy::BySize only)
+    int setSize(int x);
+
+    // Current number of disjoint sets
+    int numSets() const;
 };
 
-}
\ No newline at end of file
+}
@@ -1,159 +1,408 @@
 // Author: realyoavperetz@gmail.com
 
 #include "../include/Algorithms.hpp"
-#include "../include/Queue.hpp"
 #include "../include/PriorityQueue.hpp"
+#include "../include/DaryPriorityQueue.hpp"
+#include "../include/BucketQueue.hpp"
 #include "../include/UnionFind.hpp"
+#include "../include/Adjacency.hpp"
+#include "../include/EdgeSort.hpp"
 #include <limits>
 #include <stdexcept>
 #include <iostream>
 
 using namespace graph;
 
+// Graph type of the trees built from G (CSRGraph gives the int/int Graph)
+template <typename G>
+using TreeOf = BasicGraph<typename G::VertexType, typename G::WeightType>;
+
+// Tree edge sinks: the traversal cores report every tree edge to a sink,
+// which either adds it to a tree Graph or ignores it
+struct NoTreeSink {
+    template <typename V, typename W>
+    void add(V, V, W) {}
+};
+
+template <typename Tree>
+struct GraphTreeSink {
+    Tree& tree;
+    template <typename V, typename W>
+    void add(V u, V v, W w) { tree.addEdge(u, v, w); }
+};
+
 /*
 BFS:  is a graph traversal algorithm that explores all vertices at the current 
 depth before moving to the next level, using a queue to visit neighbors in order.
 
-Returns a BFS tree
+The visiting order doubles as the queue: order[head..visitedCount) are the
+discovered vertices whose neighbors have not been scanned yet.
 */
-Graph Algorithms::bfs(const Graph& g, int source) {
+template <typename G, typename Result, typename Sink>
+void bfsCore(const G& g, typename G::VertexType source, Result& result, Sink& sink) {
+    typedef typename G::VertexType V;
+    V* order = result.order;
+    V head = 0;
+
+    result.depth[source] = 0;
+    order[result.visitedCount++] = source;
+
+    while (head < result.visitedCount) {
+        V u = order[head++];
+
+        for (auto it = neighbors(g, u); it.valid(); it.next()) {
+            V v = it.vertex();
+
+            if (result.depth[v] == -1) {
+                result.depth[v] = result.depth[u] + 1;
+                result.parent[v] = u;
+                order[result.visitedCount++] = v;
+                sink.add(u, v, it.weight());
+            }
+        }
+    }
+}
+
+template <typename G>
+TreeOf<G> bfsImpl(const G& g, typename G::VertexType source) {
     g.validateVertex(source);
-    int n = g.getNumVertices();
-    bool* visited = new bool[n]();
-    Queue q(n);
-    Graph tree(n);
+    typename G::VertexType n = g.getNumVertices();
+    BasicTraversalResult<typename G::VertexType> result(n, source);
+    TreeOf<G> tree(n, g.isDirected());
+    GraphTreeSink<TreeOf<G>> sink{tree};
+    bfsCore(g, source, result, sink);
+    return tree;
+}
 
-    visited[source] = true;
-    q.enqueue(source);
+template <typename G>
+BasicTraversalResult<typename G::VertexType> bfsTraversalImpl(const G& g, typename G::VertexType source) {
+    g.validateVertex(source);
+    BasicTraversalResult<typename G::VertexType> result(g.getNumVertices(), source);
+    NoTreeSink sink;
+    bfsCore(g, source, result, sink);
+    return result;
+}
 
-    while (!q.isEmpty()) {
-        int u = q.dequeue();
-        Neighbor* neighbors = g.getNeighbors(u);
+Graph Algorithms::bfs(const Graph& g, int source) {
+    return bfsImpl(g, source);
+}
 
-        while (neighbors != nullptr) {
-            int v = neighbors->vertex;
-            int w = neighbors->weight;
+Graph Algorithms::bfs(const CSRGraph& g, int source) {
+    return bfsImpl(g, source);
+}
 
-            if (!visited[v]) {
-                visited[v] = true;
-                q.enqueue(v);
-                tree.addEdge(u, v, w);
-            }
-            
-            neighbors = neighbors->next;
-        }
-    }
+TraversalResult Algorithms::bfsTraversal(const Graph& g, int source) {
+    return bfsTraversalImpl(g, source);
+}
 
-    delete[] visited;
-    return tree;
+TraversalResult Algorithms::bfsTraversal(const CSRGraph& g, int source) {
+    return bfsTraversalImpl(g, source);
 }
 
-// Internal recursive DFS function
-void dfsHelper(const Graph& g, Graph& tree, int u, bool* visited) {
-  visited[u] = true;
+/*
+Iterative DFS: the call stack of the recursive version is replaced by an
+explicit stack of (vertex, neighbor cursor) frames, so deep graphs cannot
+overflow it. A frame resumes scanning its neighbors where it left off,
+which visits vertices and tree edges in exactly the recursive order.
 
-  Neighbor* neighbors = g.getNeighbors(u);
-  while (neighbors != nullptr) {
-      int v = neighbors->vertex;
-      if (!visited[v]) {
-          // Add tree edge to DFS tree
-          tree.addEdge(u, v, neighbors->weight);
-          dfsHelper(g, tree, v, visited);
+Vertices are recorded in preorder. When the result has timestamps, one
+clock ticks on every discovery and every finish (CLRS style).
+*/
+template <typename G, typename Result, typename Sink>
+void dfsCore(const G& g, typename G::VertexType source, Result& result, Sink& sink) {
+  typedef typename G::VertexType V;
+  typedef decltype(neighbors(g, source)) Cursor;
+  struct Frame {
+      V vertex;
+      Cursor it;
+  };
+
+  Frame* stack = new Frame[g.getNumVertices()];
+  V top = 0;
+  V clock = 0;
+  bool timestamps = result.hasTimestamps();
+
+  result.depth[source] = 0;
+  result.order[result.visitedCount++] = source;
+  if (timestamps) result.discovery[source] = clock++;
+  stack[top++] = {source, neighbors(g, source)};
+
+  while (top > 0) {
+      Frame& frame = stack[top - 1];
+      if (!frame.it.valid()) {
+          // All neighbors explored: u is finished
+          if (timestamps) result.finish[frame.vertex] = clock++;
+          --top;
+          continue;
+      }
+
+      V u = frame.vertex;
+      V v = frame.it.vertex();
+      auto w = frame.it.weight();
+      frame.it.next();
+
+      if (result.depth[v] == -1) {
+          // Add tree edge to DFS tree and descend into v
+          result.depth[v] = result.depth[u] + 1;
+          result.parent[v] = u;
+          result.order[result.visitedCount++] = v;
+          if (timestamps) result.discovery[v] = clock++;
+          sink.add(u, v, w);
+          stack[top++] = {v, neighbors(g, v)};
       }
-      neighbors = neighbors->next;
   }
+
+  delete[] stack;
 }
-Graph Algorithms::dfs(const Graph& g, int source) {
-  int n = g.getNumVertices();
+
+template <typename G>
+TreeOf<G> dfsImpl(const G& g, typename G::VertexType source) {
+  typename G::VertexType n = g.getNumVertices();
 
   // Input validation
   g.validateVertex(source);
-  Graph tree(n);
-  bool* visited = new bool[n];
-  for (int i = 0; i < n; ++i)
-      visited[i] = false;
-
-  // Call recursive helper
-  dfsHelper(g, tree, source, visited);
+  TreeOf<G> tree(n, g.isDirected());
+  BasicTraversalResult<typename G::VertexType> result(n, source);
+  GraphTreeSink<TreeOf<G>> sink{tree};
 
-  delete[] visited;
+  dfsCore(g, source, result, sink);
   return tree;
 }
 
-Graph Algorithms::dijkstra(const Graph& g, int source) {
-    g.validateVertex(source);  // Ensure source is valid
-    int n = g.getNumVertices();
+template <typename G>
+BasicTraversalResult<typename G::VertexType> dfsTraversalImpl(const G& g, typename G::VertexType source,
+                                                              bool timestamps) {
+  g.validateVertex(source);
+  BasicTraversalResult<typename G::VertexType> result(g.getNumVertices(), source);
+  if (timestamps) result.enableTimestamps();
+  NoTreeSink sink;
+  dfsCore(g, source, result, sink);
+  return result;
+}
 
-    // Initialize distances to all vertices as infinity
-    int* dist = new int[n];
-    for (int i = 0; i < n; ++i)
-        dist[i] = std::numeric_limits<int>::max();
-    dist[source] = 0;
+Graph Algorithms::dfs(const Graph& g, int source) {
+  return dfsImpl(g, source);
+}
+
+Graph Algorithms::dfs(const CSRGraph& g, int source) {
+  return dfsImpl(g, source);
+}
+
+TraversalResult Algorithms::dfsTraversal(const Graph& g, int source, bool timestamps) {
+  return dfsTraversalImpl(g, source, timestamps);
+}
+
+TraversalResult Algorithms::dfsTraversal(const CSRGraph& g, int source, bool timestamps) {
+  return dfsTraversalImpl(g, source, timestamps);
+}
+
+/*
+Tie rule of dijkstraCore for vertices whose shortest paths end in a
+zero-weight edge: their predecessor has the same distance, so which one
+the queue extracts first is arbitrary. Such vertices are detached and
+reattached breadth-first along tight zero-weight edges, starting from the
+other reached vertices in id order. Only called when a zero-weight edge
+set a distance during the search.
+*/
+template <typename G, typename Result>
+void attachZeroWeightTies(const G& g, Result& result, typename G::WeightType* parentWeight) {
+    typedef typename G::VertexType V;
+    V n = g.getNumVertices();
+    const typename G::DistanceType* dist = result.dist;
+    V* parent = result.parent;
+
+    bool any = false;
+    for (V v = 0; v < n; ++v) {
+        if (parent[v] != -1 && dist[parent[v]] == dist[v]) {
+            parent[v] = -1;
+            any = true;
+        }
+    }
+    if (!any) return;
+
+    V* queue = new V[n];
+    V head = 0, tail = 0;
+    for (V v = 0; v < n; ++v)
+        if (result.reachable(v) && (v == result.source || parent[v] != -1))
+            queue[tail++] = v;
+    while (head < tail) {
+        V u = queue[head++];
+        for (auto it = neighbors(g, u); it.valid(); it.next()) {
+            V v = it.vertex();
+            if (it.weight() == 0 && v != result.source && parent[v] == -1 && dist[v] == dist[u]) {
+                parent[v] = u;
+                if (parentWeight != nullptr) parentWeight[v] = 0;
+                queue[tail++] = v;
+            }
+        }
+    }
+    delete[] queue;
+}
 
-    // Track the parent of each node in the shortest path
-    int* prev = new int[n];
-    for (int i = 0; i < n; ++i)
-        prev[i] = -1;
+// Dijkstra body shared by every queue type; pq is empty with capacity n
+// and result starts with every vertex unreachable. parentWeight, if not
+// null, receives the weight of the edge from parent[v] to v.
+template <typename PQ, typename G, typename Result>
+void dijkstraCore(const G& g, typename G::VertexType source, PQ& pq, Result& result,
+                  typename G::WeightType* parentWeight = nullptr) {
+    typedef typename G::VertexType V;
+    typedef typename G::DistanceType D;
+    V n = g.getNumVertices();
+    D* dist = result.dist;
+    V* prev = result.parent;
+    dist[source] = 0;
 
     // Track visited vertices
     bool* visited = new bool[n]();
+    bool zeroWeightParents = false;
 
-    // Create a priority queue and insert all vertices
-    PriorityQueue pq(n);
-    for (int i = 0; i < n; ++i)
+    // Insert all vertices into the priority queue
+    for (V i = 0; i < n; ++i)
         pq.insert(i, dist[i]);
 
     // Main Dijkstra loop
     while (!pq.isEmpty()) {
-        int u = pq.extractMin();
+        V u = pq.extractMin();
         visited[u] = true;
 
-        Neighbor* neighbors = g.getNeighbors(u);
-        while (neighbors != nullptr) {
-            int v = neighbors->vertex;
-            int weight = neighbors->weight;
+        for (auto it = neighbors(g, u); it.valid(); it.next()) {
+            V v = it.vertex();
+            D weight = it.weight();
 
             // Dijkstra doesn't support negative weights
             if (weight < 0) {
-                delete[] dist;
-                delete[] prev;
                 delete[] visited;
                 throw "Graph contains a negative weight edge – Dijkstra is not allowed";
             }
 
             // ✅ Prevent overflow and incorrect updates
-            if (dist[u] != std::numeric_limits<int>::max() && !visited[v] && dist[u] + weight < dist[v]) {
+            if (dist[u] == std::numeric_limits<D>::max() || visited[v]) continue;
+            if (dist[u] + weight < dist[v]) {
                 dist[v] = dist[u] + weight;
                 prev[v] = u;
+                if (parentWeight != nullptr) parentWeight[v] = it.weight();
                 pq.updateDistance(v, dist[v]);
+                if (weight == 0) zeroWeightParents = true;
+            } else if (dist[u] + weight == dist[v] && weight > 0 &&
+                       (u < prev[v] || dist[prev[v]] == dist[v])) {
+                // Tie: keep the smallest parent, whatever order the queue
+                // extracted them in (all of them come before v)
+                prev[v] = u;
+                if (parentWeight != nullptr) parentWeight[v] = it.weight();
             }
+        }
+    }
+
+    delete[] visited;
+    if (zeroWeightParents) attachZeroWeightTies(g, result, parentWeight);
+}
 
-            neighbors = neighbors->next;
+// Build the shortest path tree graph from the parents and the weights of
+// the edges that set them, so no adjacency list has to be scanned
+template <typename Tree, typename Result>
+Tree shortestPathTree(const Result& result, const typename Tree::WeightType* parentWeight, bool directed) {
+    typedef typename Tree::VertexType V;
+    Tree tree(result.numVertices, directed);
+    for (V v = 0; v < result.numVertices; ++v) {
+        V p = result.parent[v];
+        if (p != -1 && result.reachable(v)) {
+            tree.addEdge(p, v, parentWeight[v]);
         }
     }
+    return tree;
+}
 
-    // Build the shortest path tree graph
-    Graph tree(n);
-    for (int v = 0; v < n; ++v) {
-        if (prev[v] != -1 && dist[v] != std::numeric_limits<int>::max()) {
-            Neighbor* neighbor = g.getNeighbors(prev[v]);
-            while (neighbor != nullptr) {
-                if (neighbor->vertex == v) {
-                    tree.addEdge(prev[v], v, neighbor->weight);
-                    break;
-                }
-                neighbor = neighbor->next;
-            }
+template <typename PQ, typename G>
+TreeOf<G> dijkstraImpl(const G& g, typename G::VertexType source, PQ& pq) {
+    g.validateVertex(source);  // Ensure source is valid
+    typename G::VertexType n = g.getNumVertices();
+    BasicShortestPathResult<typename G::VertexType, typename G::DistanceType> result(n, source);
+    typename G::WeightType* parentWeight = new typename G::WeightType[n];
+    try {
+        dijkstraCore(g, source, pq, result, parentWeight);
+    } catch (...) {
+        delete[] parentWeight;
+        throw;
+    }
+    TreeOf<G> tree = shortestPathTree<TreeOf<G>>(result, parentWeight, g.isDirected());
+    delete[] parentWeight;
+    return tree;
+}
+
+Graph Algorithms::dijkstra(const Graph& g, int source) {
+    PriorityQueue pq(g.getNumVertices());
+    return dijkstraImpl(g, source, pq);
+}
+
+Graph Algorithms::dijkstra(const CSRGraph& g, int source) {
+    PriorityQueue pq(g.getNumVertices());
+    return dijkstraImpl(g, source, pq);
+}
+
+template <typename G>
+ShortestPathResult dijkstraDistancesImpl(const G& g, int source) {
+    g.validateVertex(source);
+    int n = g.getNumVertices();
+    ShortestPathResult result(n, source);
+    PriorityQueue pq(n);
+    dijkstraCore(g, source, pq, result);
+    return result;
+}
+
+ShortestPathResult Algorithms::dijkstraDistances(const Graph& g, int source) {
+    return dijkstraDistancesImpl(g, source);
+}
+
+ShortestPathResult Algorithms::dijkstraDistances(const CSRGraph& g, int source) {
+    return dijkstraDistancesImpl(g, source);
+}
+
+template <typename PQ, typename G>
+Graph Algorithms::dijkstra(const G& g, int source) {
+    PQ pq(g.getNumVertices());
+    return dijkstraImpl(g, source, pq);
+}
+
+// Largest edge weight of g (0 without edges), or -1 if any weight is negative
+template <typename G>
+int maxEdgeWeight(const G& g) {
+    int maxWeight = 0;
+    for (int u = 0; u < g.getNumVertices(); ++u) {
+        for (auto it = neighbors(g, u); it.valid(); it.next()) {
+            if (it.weight() < 0) return -1;
+            if (it.weight() > maxWeight) maxWeight = it.weight();
         }
     }
+    return maxWeight;
+}
 
-    delete[] dist;
-    delete[] prev;
-    delete[] visited;
+// Use Dial's buckets when the weights allow it, the binary heap otherwise
+template <typename G>
+Graph dijkstraBucketsImpl(const G& g, int source, int weightLimit) {
+    g.validateVertex(source);
+    int n = g.getNumVertices();
+    int maxWeight = maxEdgeWeight(g);
 
-    return tree;
+    // Negative weights also go to the heap version, which reports them
+    if (maxWeight < 0 || maxWeight > weightLimit) {
+        PriorityQueue pq(n);
+        return dijkstraImpl(g, source, pq);
+    }
+    BucketQueue pq(n, maxWeight);
+    return dijkstraImpl(g, source, pq);
 }
-Graph Algorithms::prim(const Graph& g) {
+
+Graph Algorithms::dijkstraBuckets(const Graph& g, int source, int weightLimit) {
+    return dijkstraBucketsImpl(g, source, weightLimit);
+}
+
+Graph Algorithms::dijkstraBuckets(const CSRGraph& g, int source, int weightLimit) {
+    return dijkstraBucketsImpl(g, source, weightLimit);
+}
+
+template <typename PQ, typename G>
+Graph primImpl(const G& g) {
+  requireUndirected(g);
   int n = g.getNumVertices();
 
   // Arrays for MST logic
@@ -170,7 +419,7 @@ Graph Algorithms::prim(const Graph& g) {
   // Start from node 0
   minWeight[0] = 0;
 
-  PriorityQueue pq(n);
+  PQ pq(n);
   for (int i = 0; i < n; ++i)
       pq.insert(i, minWeight[i]);
 
@@ -178,10 +427,9 @@ Graph Algorithms::prim(const Graph& g) {
       int u = pq.extractMin();
       inTree[u] = true;
 
-      Neighbor* neighbors = g.getNeighbors(u);
-      while (neighbors != nullptr) {
-          int v = neighbors->vertex;
-          int weight = neighbors->weight;
+      for (auto it = neighbors(g, u); it.valid(); it.next()) {
+          int v = it.vertex();
+          int weight = it.weight();
 
           // Update v if this edge is better and v not in MST yet
           if (!inTree[v] && weight < minWeight[v]) {
@@ -189,8 +437,6 @@ Graph Algorithms::prim(const Graph& g) {
               parent[v] = u;
               pq.updateDistance(v, weight);
           }
-
-          neighbors = neighbors->next;
       }
   }
 
@@ -198,13 +444,11 @@ Graph Algorithms::prim(const Graph& g) {
   Graph mst(n);
   for (int v = 1; v < n; ++v) {
       if (parent[v] != -1) {
-          Neighbor* neighbor = g.getNeighbors(v);
-          while (neighbor != nullptr) {
-              if (neighbor->vertex == parent[v]) {
-                  mst.addEdge(v, parent[v], neighbor->weight);
+          for (auto it = neighbors(g, v); it.valid(); it.next()) {
+              if (it.vertex() == parent[v]) {
+                  mst.addEdge(v, parent[v], it.weight());
                   break;
               }
-              neighbor = neighbor->next;
           }
       }
   }
@@ -216,74 +460,94 @@ Graph Algorithms::prim(const Graph& g) {
 
   return mst;
 }
-// Helper Edge struct - for Merge Sort
-struct Edge {
-    int u, v, weight;
-};
 
-// Merge function for Merge Sort
-void merge(Edge* arr, int left, int mid, int right) {
-    int n1 = mid - left + 1;
-    int n2 = right - mid;
-
-    Edge* L = new Edge[n1];
-    Edge* R = new Edge[n2];
+Graph Algorithms::prim(const Graph& g) {
+  return primImpl<PriorityQueue>(g);
+}
 
-    for (int i = 0; i < n1; ++i) L[i] = arr[left + i];
-    for (int j = 0; j < n2; ++j) R[j] = arr[mid + 1 + j];
+Graph Algorithms::prim(const CSRGraph& g) {
+  return primImpl<PriorityQueue>(g);
+}
 
-    int i = 0, j = 0, k = left;
+template <typename PQ, typename G>
+Graph Algorithms::prim(const G& g) {
+  return primImpl<PQ>(g);
+}
 
-    while (i < n1 && j < n2) {
-        if (L[i].weight <= R[j].weight)
-            arr[k++] = L[i++];
-        else
-            arr[k++] = R[j++];
-    }
+// ----------------------------------------------------------
+// Generic BasicGraph<V, W> versions
+// ----------------------------------------------------------
 
-    while (i < n1) arr[k++] = L[i++];
-    while (j < n2) arr[k++] = R[j++];
+template <typename V, typename W>
+BasicGraph<V, W> Algorithms::bfs(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source) {
+    return bfsImpl(g, source);
+}
 
-    delete[] L;
-    delete[] R;
+template <typename V, typename W>
+BasicTraversalResult<V> Algorithms::bfsTraversal(const BasicGraph<V, W>& g,
+                                                 typename NonDeduced<V>::type source) {
+    return bfsTraversalImpl(g, source);
 }
 
-// Merge Sort on array of edges
-void mergeSort(Edge* arr, int left, int right) {
-    if (left < right) {
-        int mid = left + (right - left) / 2;
-        mergeSort(arr, left, mid);
-        mergeSort(arr, mid + 1, right);
-        merge(arr, left, mid, right);
-    }
+template <typename V, typename W>
+BasicGraph<V, W> Algorithms::dfs(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source) {
+    return dfsImpl(g, source);
 }
-Graph Algorithms::kruskal(const Graph& g) {
-    int n = g.getNumVertices();
 
-    // Step 1: collect all edges
-    const int MAX_EDGES = n * n;
-    Edge* edges = new Edge[MAX_EDGES];
-    int edgeCount = 0;
-
-    for (int u = 0; u < n; ++u) {
-        Neighbor* curr = g.getNeighbors(u);
-        while (curr != nullptr) {
-            int v = curr->vertex;
-            if (u < v) {
-                edges[edgeCount++] = {u, v, curr->weight};
-            }
-            curr = curr->next;
-        }
-    }
+template <typename V, typename W>
+BasicTraversalResult<V> Algorithms::dfsTraversal(const BasicGraph<V, W>& g,
+                                                 typename NonDeduced<V>::type source, bool timestamps) {
+    return dfsTraversalImpl(g, source, timestamps);
+}
 
-    // Step 2: sort edges by weight
-    mergeSort(edges, 0, edgeCount - 1);
+template <typename V, typename W>
+BasicGraph<V, W> Algorithms::dijkstra(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source) {
+    DaryPriorityQueue<4, V, typename BasicGraph<V, W>::DistanceType> pq(g.getNumVertices());
+    return dijkstraImpl(g, source, pq);
+}
 
-    // Step 3: Kruskal's algorithm with Union-Find
-    UnionFind uf(n);
-    Graph mst(n);
+template <typename V, typename W>
+BasicShortestPathResult<V, typename BasicGraph<V, W>::DistanceType>
+Algorithms::dijkstraDistances(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source) {
+    g.validateVertex(source);
+    V n = g.getNumVertices();
+    BasicShortestPathResult<V, typename BasicGraph<V, W>::DistanceType> result(n, source);
+    DaryPriorityQueue<4, V, typename BasicGraph<V, W>::DistanceType> pq(n);
+    dijkstraCore(g, source, pq, result);
+    return result;
+}
 
-    for (int i = 0; i < edgeCount; ++i) {
+#define GRAPH_INSTANTIATE_GENERIC(V, W)                                                          \
+    template BasicGraph<V, W> Algorithms::bfs<V, W>(const BasicGraph<V, W>&, V);                \
+    template BasicTraversalResult<V> Algorithms::bfsTraversal<V, W>(const BasicGraph<V, W>&, V); \
+    template BasicGraph<V, W> Algorithms::dfs<V, W>(const BasicGraph<V, W>&, V);                \
+    template BasicTraversalResult<V> Algorithms::dfsTraversal<V, W>(const BasicGraph<V, W>&, V, bool); \
+    template BasicGraph<V, W> Algorithms::dijkstra<V, W>(const BasicGraph<V, W>&, V);           \
+    template BasicShortestPathResult<V, BasicGraph<V, W>::DistanceType>                          \
+    Algorithms::dijkstraDistances<V, W>(const BasicGraph<V, W>&, V);
+
+GRAPH_FOR_EACH_TYPE_PAIR(GRAPH_INSTANTIATE_GENERIC)
+#undef GRAPH_INSTANTIATE_GENERIC
+
+// Supported queue/backend combinations for the templated dijkstra and prim
+#define GRAPH_INSTANTIATE_WITH_QUEUE(PQ)                                   \
+    template Graph Algorithms::dijkstra<PQ, Graph>(const Graph&, int);       \
+    template Graph Algorithms::dijkstra<PQ, CSRGraph>(const CSRGraph&, int); \
+    template Graph Algorithms::prim<PQ, Graph>(const Graph&);                \
+    template Graph Algorithms::prim<PQ, CSRGraph>(const CSRGraph&);
+
+GRAPH_INSTANTIATE_WITH_QUEUE(PriorityQueue)
+GRAPH_INSTANTIATE_WITH_QUEUE(DaryPriorityQueue<2>)
+GRAPH_INSTANTIATE_WITH_QUEUE(DaryPriorityQueue<4>)
+GRAPH_INSTANTIATE_WITH_QUEUE(DaryPriorityQueue<8>)
+#undef GRAPH_INSTANTIATE_WITH_QUEUE
+
+// Ranges at most this long are sorted and scanned directly
+static const int FILTER_KRUSKAL_BASE = 1024;
+
+// Plain Kruskal step over a sorted range: add every edge joining two components
+void kruskalScan(const Edge* edges, int count, UnionFind& uf, Graph& mst) {
+    for (int i = 0; i < count; ++i) {
         int u = edges[i].u;
         int v = edges[i].v;
         int w = edges[i].weight;
@@ -293,8 +557,104 @@ Graph Algorithms::kruskal(const Graph& g) {
             mst.addEdge(u, v, w);
         }
     }
+}
+
+/*
+Filter-Kruskal (Osipov, Sanders, Singler):
+partition the edges around a pivot like quicksort, solve the light half
+first, then drop every heavy edge whose endpoints are already connected
+before recursing into it. Edges inside a component are never sorted.
+Everything happens in place in the edge array.
+
+Edges are accepted in edgeLess order, exactly as a full sort would, so
+the forest (and its insertion order) does not depend on the pivots.
+*/
+void filterKruskal(Edge* edges, int count, UnionFind& uf, Graph& mst, int depthLimit) {
+    if (count <= FILTER_KRUSKAL_BASE || depthLimit == 0) {
+        sortEdges(edges, count);
+        kruskalScan(edges, count, uf, mst);
+        return;
+    }
+
+    // Median of three as pivot
+    Edge a = edges[0], b = edges[count / 2], c = edges[count - 1];
+    Edge pivot = edgeLess(a, b) ? (edgeLess(b, c) ? b : (edgeLess(a, c) ? c : a))
+                                : (edgeLess(a, c) ? a : (edgeLess(b, c) ? c : b));
+
+    // Light part [0, split): edges not heavier than the pivot
+    int split = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!edgeLess(pivot, edges[i])) {
+            Edge temp = edges[i];
+            edges[i] = edges[split];
+            edges[split++] = temp;
+        }
+    }
+
+    filterKruskal(edges, split, uf, mst, depthLimit - 1);
+
+    // Filter: keep only heavy edges that still join two components
+    int kept = split;
+    for (int i = split; i < count; ++i)
+        if (!uf.connected(edges[i].u, edges[i].v))
+            edges[kept++] = edges[i];
+
+    filterKruskal(edges + split, kept - split, uf, mst, depthLimit - 1);
+}
+
+template <typename G>
+Graph kruskalImpl(const G& g) {
+    requireUndirected(g);
+    int n = g.getNumVertices();
+
+    // Step 1: collect all edges, sized by the actual edge count
+    Edge* edges = new Edge[countEdges(g)];
+    int edgeCount = collectEdges(g, edges);
+
+    // Step 2 + 3: Filter-Kruskal with Union-Find
+    UnionFind uf(n);
+    Graph mst(n);
+
+    int depthLimit = 0;
+    for (int c = edgeCount; c > 1; c >>= 1)
+        depthLimit += 2;
+    filterKruskal(edges, edgeCount, uf, mst, depthLimit);
+
+    delete[] edges;
+    return mst;
+}
+
+Graph Algorithms::kruskal(const Graph& g) {
+    return kruskalImpl(g);
+}
+
+Graph Algorithms::kruskal(const CSRGraph& g) {
+    return kruskalImpl(g);
+}
+
+// Kruskal with a full parallel radix sort instead of Filter-Kruskal
+template <typename G>
+Graph kruskalRadixImpl(const G& g, int numThreads) {
+    requireUndirected(g);
+    int n = g.getNumVertices();
+
+    Edge* edges = new Edge[countEdges(g)];
+    int edgeCount = collectEdges(g, edges);
+    radixSortEdgesTotal(edges, edgeCount, numThreads);
+
+    UnionFind uf(n);
+    Graph mst(n);
+    kruskalScan(edges, edgeCount, uf, mst);
 
     delete[] edges;
     return mst;
 }
 
+Graph Algorithms::kruskal(const Graph& g, int numThreads) {
+    return kruskalRadixImpl(g, numThreads);
+}
+
+Graph Algorithms::kruskal(const CSRGraph& g, int numThreads) {
+    return kruskalRadixImpl(g, numThreads);
+}
+
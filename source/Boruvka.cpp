@@ -0,0 +1,108 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/Algorithms.hpp"
+#include "../include/Adjacency.hpp"
+#include "../include/EdgeSort.hpp"
+#include "../include/Parallel.hpp"
+#include "../include/UnionFind.hpp"
+#include <atomic>
+
+using namespace graph;
+
+static const int NO_EDGE = -1;
+
+// Lower best to edge i if edge i comes first in edgeLess order
+static void atomicMin(std::atomic<int>& best, int i, const Edge* edges) {
+    int current = best.load(std::memory_order_relaxed);
+    while ((current == NO_EDGE || edgeLess(edges[i], edges[current])) &&
+           !best.compare_exchange_weak(current, i, std::memory_order_relaxed)) {
+    }
+}
+
+/*
+Boruvka:
+every round, each component picks its lightest outgoing edge and all
+picked edges are added at once, at least halving the number of
+components. The edge scan of a round is split across threads; each
+thread lowers best[component] (an edge index) with an atomic minimum. Component labels
+are refreshed from the UnionFind before every round, so the threads only
+read them, and the contraction (uniting the picked edges) is sequential.
+
+Edges are compared with edgeLess, the same total order kruskal accepts
+them in, so both algorithms pick the same forest.
+*/
+template <typename G>
+Graph boruvkaImpl(const G& g, int numThreads) {
+    requireUndirected(g);
+    int n = g.getNumVertices();
+    numThreads = resolveThreadCount(numThreads);
+
+    Edge* edges = new Edge[countEdges(g)];
+    int edgeCount = collectEdges(g, edges);
+
+    UnionFind uf(n);
+    int* component = new int[n];
+    std::atomic<int>* best = new std::atomic<int>[n];
+    bool* chosen = new bool[edgeCount]();
+    int chosenCount = 0;
+
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int v = 0; v < n; ++v) {
+            component[v] = uf.find(v);
+            best[v].store(NO_EDGE, std::memory_order_relaxed);
+        }
+
+        // Lightest outgoing edge per component, scanned in parallel
+        runParallel(numThreads, [&](int threadId) {
+            long long begin = static_cast<long long>(edgeCount) * threadId / numThreads;
+            long long end = static_cast<long long>(edgeCount) * (threadId + 1) / numThreads;
+            for (long long i = begin; i < end; ++i) {
+                int cu = component[edges[i].u];
+                int cv = component[edges[i].v];
+                if (cu == cv) continue;
+                atomicMin(best[cu], static_cast<int>(i), edges);
+                atomicMin(best[cv], static_cast<int>(i), edges);
+            }
+        });
+
+        // Contract along the picked edges
+        for (int c = 0; c < n; ++c) {
+            int i = best[c].load(std::memory_order_relaxed);
+            if (i == NO_EDGE) continue;
+            if (!uf.connected(edges[i].u, edges[i].v)) {
+                uf.unite(edges[i].u, edges[i].v);
+                chosen[i] = true;
+                ++chosenCount;
+                merged = true;
+            }
+        }
+    }
+
+    // Add the forest edges in kruskal's order
+    Edge* forest = new Edge[chosenCount];
+    int k = 0;
+    for (int i = 0; i < edgeCount; ++i)
+        if (chosen[i]) forest[k++] = edges[i];
+    sortEdges(forest, chosenCount);
+
+    Graph mst(n);
+    for (int i = 0; i < chosenCount; ++i)
+        mst.addEdge(forest[i].u, forest[i].v, forest[i].weight);
+
+    delete[] forest;
+    delete[] chosen;
+    delete[] best;
+    delete[] component;
+    delete[] edges;
+    return mst;
+}
+
+Graph Algorithms::boruvka(const Graph& g, int numThreads) {
+    return boruvkaImpl(g, numThreads);
+}
+
+Graph Algorithms::boruvka(const CSRGraph& g, int numThreads) {
+    return boruvkaImpl(g, numThreads);
+}
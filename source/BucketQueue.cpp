@@ -0,0 +1,139 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/BucketQueue.hpp"
+#include <limits>
+
+using namespace graph;
+
+static const int INFINITE_KEY = std::numeric_limits<int>::max();
+
+// Constructor: allocate per-vertex lists and maxWeight + 1 buckets
+BucketQueue::BucketQueue(int cap, int maxWeight) {
+    if (cap < 0 || maxWeight < 0)
+        throw "Invalid bucket queue size";
+
+    capacity = cap;
+    numBuckets = maxWeight + 1;
+    finiteCount = 0;
+    parkedCount = 0;
+    cursorKey = 0;
+
+    keys = new int[cap];
+    bucketOf = new int[cap];
+    nextInList = new int[cap];
+    prevInList = new int[cap];
+    heads = new int[numBuckets + 1];
+
+    for (int v = 0; v < cap; ++v)
+        bucketOf[v] = -1; // not in the queue
+    for (int b = 0; b <= numBuckets; ++b)
+        heads[b] = -1;    // empty list
+}
+
+// Destructor: free allocated arrays
+BucketQueue::~BucketQueue() {
+    delete[] keys;
+    delete[] bucketOf;
+    delete[] nextInList;
+    delete[] prevInList;
+    delete[] heads;
+}
+
+// Push vertex at the front of list `bucket`
+void BucketQueue::link(int vertex, int bucket) {
+    bucketOf[vertex] = bucket;
+    prevInList[vertex] = -1;
+    nextInList[vertex] = heads[bucket];
+    if (heads[bucket] != -1)
+        prevInList[heads[bucket]] = vertex;
+    heads[bucket] = vertex;
+}
+
+// Remove vertex from whichever list holds it
+void BucketQueue::unlink(int vertex) {
+    int bucket = bucketOf[vertex];
+    if (prevInList[vertex] != -1)
+        nextInList[prevInList[vertex]] = nextInList[vertex];
+    else
+        heads[bucket] = nextInList[vertex];
+    if (nextInList[vertex] != -1)
+        prevInList[nextInList[vertex]] = prevInList[vertex];
+
+    if (bucket == numBuckets) --parkedCount;
+    else --finiteCount;
+    bucketOf[vertex] = -1;
+}
+
+// Store vertex with the given key, enforcing the monotone window
+void BucketQueue::place(int vertex, int key) {
+    keys[vertex] = key;
+    if (key == INFINITE_KEY) {
+        link(vertex, numBuckets);
+        ++parkedCount;
+        return;
+    }
+
+    // With no finite keys stored the window may slide forward to reach key
+    if (finiteCount == 0 && key - cursorKey >= numBuckets)
+        cursorKey = key - numBuckets + 1;
+    if (key < cursorKey || key - cursorKey >= numBuckets)
+        throw "Key outside bucket queue range";
+
+    link(vertex, key % numBuckets);
+    ++finiteCount;
+}
+
+// Check if the queue is empty
+bool BucketQueue::isEmpty() const {
+    return finiteCount == 0 && parkedCount == 0;
+}
+
+// Insert new (vertex, distance) into the queue
+void BucketQueue::insert(int vertex, int distance) {
+    if (vertex < 0 || vertex >= capacity)
+        throw "Vertex out of range";
+    if (bucketOf[vertex] != -1)
+        throw "Vertex already in heap";
+    if (distance < 0)
+        throw "Negative key in bucket queue";
+    place(vertex, distance);
+}
+
+// Remove and return the vertex with the smallest distance.
+// Parked (infinite) vertices come out only after every finite one.
+int BucketQueue::extractMin() {
+    if (isEmpty())
+        throw "Heap is empty";
+
+    int vertex;
+    if (finiteCount > 0) {
+        while (heads[cursorKey % numBuckets] == -1)
+            ++cursorKey;
+        vertex = heads[cursorKey % numBuckets];
+    } else {
+        vertex = heads[numBuckets];
+    }
+    unlink(vertex);
+    return vertex;
+}
+
+// Return true if vertex exists in the queue
+bool BucketQueue::contains(int vertex) const {
+    return vertex >= 0 && vertex < capacity && bucketOf[vertex] != -1;
+}
+
+// Return the stored distance of a vertex
+int BucketQueue::getDistance(int vertex) const {
+    if (!contains(vertex))
+        return INFINITE_KEY; // default "infinite"
+    return keys[vertex];
+}
+
+// Move a vertex to the bucket of its new key
+void BucketQueue::updateDistance(int vertex, int newDist) {
+    if (!contains(vertex)) return;
+    if (newDist < 0)
+        throw "Negative key in bucket queue";
+    unlink(vertex);
+    place(vertex, newDist);
+}
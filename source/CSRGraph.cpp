@@ -0,0 +1,403 @@
+// Author: realyoavperetz@gmail.com
+
+#include <iostream>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../include/CSRGraph.hpp"
+
+using namespace graph;
+
+namespace {
+
+const char FILE_MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+const uint32_t FILE_VERSION = 2;
+const uint32_t FILE_BYTE_ORDER = 0x01020304;
+const uint32_t FLAG_DIRECTED = 1;
+
+// Header at the start of a graph file; version 1 files end after numEntries
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  int64_t numVertices;
+  int64_t numEntries;
+  uint32_t flags;     // since version 2
+  uint32_t reserved;
+};
+
+const size_t HEADER_V1_SIZE = 32;
+
+static_assert(sizeof(FileHeader) == 40, "Graph file header must be 40 bytes");
+
+// Write count ints, throwing on a short write
+void writeInts(std::FILE* file, const int* data, size_t count) {
+  if (count > 0 && std::fwrite(data, sizeof(int), count, file) != count) {
+    std::fclose(file);
+    throw "Failed to write graph file";
+  }
+}
+
+std::FILE* openForWriting(const char* path, int numVertices, int numEntries, bool directed) {
+  std::FILE* file = std::fopen(path, "wb");
+  if (file == nullptr) {
+    throw "Failed to open graph file";
+  }
+  FileHeader header;
+  std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+  header.version = FILE_VERSION;
+  header.byteOrder = FILE_BYTE_ORDER;
+  header.numVertices = numVertices;
+  header.numEntries = numEntries;
+  header.flags = directed ? FLAG_DIRECTED : 0;
+  header.reserved = 0;
+  if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+    std::fclose(file);
+    throw "Failed to write graph file";
+  }
+  return file;
+}
+
+void finishWriting(std::FILE* file) {
+  if (std::fclose(file) != 0) {
+    throw "Failed to write graph file";
+  }
+}
+
+}
+
+//Copy the adjacency lists of g into contiguous arrays (list order is kept)
+CSRGraph::CSRGraph(const Graph& g)
+    : numVertices(g.getNumVertices()), numEntries(0), directed(g.isDirected()),
+      mapping(nullptr), mappingSize(0) {
+  offsets = new int[numVertices + 1];
+
+  //First pass: count the degree of every vertex
+  offsets[0] = 0;
+  for (int v = 0; v < numVertices; ++v) {
+    int degree = 0;
+    for (Neighbor* n = g.getNeighbors(v); n != nullptr; n = n->next)
+      ++degree;
+    offsets[v + 1] = offsets[v] + degree;
+  }
+  numEntries = offsets[numVertices];
+
+  //Second pass: copy every neighbor into its slot
+  targets = new int[numEntries];
+  weights = new int[numEntries];
+  for (int v = 0; v < numVertices; ++v) {
+    int i = offsets[v];
+    for (Neighbor* n = g.getNeighbors(v); n != nullptr; n = n->next) {
+      targets[i] = n->vertex;
+      weights[i] = n->weight;
+      ++i;
+    }
+  }
+}
+
+//Build from an edge list. Graph::addEdge prepends to the neighbor list, so
+//every row is filled from its end to report neighbors in the same order.
+CSRGraph::CSRGraph(int numVertices, const Edge* edges, int edgeCount, bool directed)
+    : CSRGraph(numVertices, &edges, &edgeCount, 1, directed) {}
+
+//Count degrees over every chunk, then scatter each chunk in order; no
+//concatenated copy of the edges is needed
+CSRGraph::CSRGraph(int numVertices, const Edge* const* chunks, const int* chunkSizes, int numChunks,
+                   bool directed)
+    : numVertices(numVertices), numEntries(0), directed(directed), mapping(nullptr), mappingSize(0) {
+  if (numVertices < 0 || numChunks < 0) {
+    throw "Invalid graph size";
+  }
+  //Offsets are int32: an undirected graph holds at most INT_MAX / 2 edges
+  long long entries = 0;
+  for (int c = 0; c < numChunks; ++c) {
+    if (chunkSizes[c] < 0) {
+      throw "Invalid graph size";
+    }
+    entries += directed ? (long long)chunkSizes[c] : 2LL * chunkSizes[c];
+  }
+  if (entries > INT32_MAX) {
+    throw "Too many edges for CSRGraph";
+  }
+  numEntries = (int)entries;
+  for (int c = 0; c < numChunks; ++c) {
+    for (int i = 0; i < chunkSizes[c]; ++i) {
+      validateVertex(chunks[c][i].u);
+      validateVertex(chunks[c][i].v);
+    }
+  }
+
+  offsets = new int[numVertices + 1]();
+
+  //Count degrees, shifted by one so the prefix sum yields the row offsets
+  for (int c = 0; c < numChunks; ++c) {
+    for (int i = 0; i < chunkSizes[c]; ++i) {
+      ++offsets[chunks[c][i].u + 1];
+      if (!directed) ++offsets[chunks[c][i].v + 1];
+    }
+  }
+  for (int v = 0; v < numVertices; ++v)
+    offsets[v + 1] += offsets[v];
+
+  targets = new int[numEntries];
+  weights = new int[numEntries];
+
+  //cursor[v] is the next free slot of v, walking down from the row end
+  int* cursor = new int[numVertices];
+  for (int v = 0; v < numVertices; ++v)
+    cursor[v] = offsets[v + 1];
+
+  for (int c = 0; c < numChunks; ++c) {
+    for (int i = 0; i < chunkSizes[c]; ++i) {
+      const Edge& e = chunks[c][i];
+      int slot = --cursor[e.u];
+      targets[slot] = e.v;
+      weights[slot] = e.weight;
+      if (directed) continue;
+
+      slot = --cursor[e.v];
+      targets[slot] = e.u;
+      weights[slot] = e.weight;
+    }
+  }
+
+  delete[] cursor;
+}
+
+//Map a graph file read-only. Only the header and the two ends of the
+//offsets are checked, so opening does not touch the bulk of the file.
+CSRGraph::CSRGraph(const char* path)
+    : numVertices(0), numEntries(0), directed(false), offsets(nullptr), targets(nullptr),
+      weights(nullptr), mapping(nullptr), mappingSize(0) {
+  int fd = ::open(path, O_RDONLY);
+  if (fd < 0) {
+    throw "Failed to open graph file";
+  }
+  struct stat info;
+  if (::fstat(fd, &info) != 0) {
+    ::close(fd);
+    throw "Failed to open graph file";
+  }
+  if (info.st_size < (off_t)HEADER_V1_SIZE) {
+    ::close(fd);
+    throw "Invalid graph file";
+  }
+
+  mappingSize = (size_t)info.st_size;
+  void* data = ::mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); //the mapping keeps the file alive
+  if (data == MAP_FAILED) {
+    throw "Failed to map graph file";
+  }
+
+  const FileHeader* header = (const FileHeader*)data;
+  size_t headerSize = 0;
+  const char* error = nullptr;
+  if (std::memcmp(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) {
+    error = "Invalid graph file";
+  } else if (header->version != 1 && header->version != FILE_VERSION) {
+    error = "Unsupported graph file version";
+  } else if (header->version >= 2 && mappingSize < sizeof(FileHeader)) {
+    error = "Invalid graph file";
+  } else if (header->byteOrder != FILE_BYTE_ORDER) {
+    error = "Graph file has a different byte order";
+  } else if (header->numVertices < 0 || header->numVertices >= INT32_MAX ||
+             header->numEntries < 0 || header->numEntries > INT32_MAX) {
+    error = "Invalid graph file";
+  } else {
+    headerSize = header->version == 1 ? HEADER_V1_SIZE : sizeof(FileHeader);
+    uint64_t expected = headerSize +
+        sizeof(int) * ((uint64_t)header->numVertices + 1 + 2 * (uint64_t)header->numEntries);
+    if (expected != mappingSize) {
+      error = "Invalid graph file";
+    }
+  }
+  if (error == nullptr) {
+    numVertices = (int)header->numVertices;
+    numEntries = (int)header->numEntries;
+    directed = header->version >= 2 && (header->flags & FLAG_DIRECTED) != 0;
+    offsets = (int*)((char*)data + headerSize);
+    targets = offsets + numVertices + 1;
+    weights = targets + numEntries;
+    if (offsets[0] != 0 || offsets[numVertices] != numEntries) {
+      error = "Invalid graph file";
+    }
+  }
+  if (error != nullptr) {
+    ::munmap(data, mappingSize);
+    throw error;
+  }
+  mapping = data;
+}
+
+//Destructor: free the three arrays, or unmap the file they live in
+CSRGraph::~CSRGraph() {
+  if (mapping != nullptr) {
+    ::munmap(mapping, mappingSize);
+    return;
+  }
+  delete[] offsets;
+  delete[] targets;
+  delete[] weights;
+}
+
+//Move constructor: steal the arrays and leave other as an empty graph
+CSRGraph::CSRGraph(CSRGraph&& other) noexcept
+    : numVertices(other.numVertices), numEntries(other.numEntries), directed(other.directed), offsets(other.offsets),
+      targets(other.targets), weights(other.weights), mapping(other.mapping),
+      mappingSize(other.mappingSize) {
+  other.numVertices = 0;
+  other.numEntries = 0;
+  other.offsets = nullptr;
+  other.targets = nullptr;
+  other.weights = nullptr;
+  other.mapping = nullptr;
+  other.mappingSize = 0;
+}
+
+//Move assignment: release our own storage and take over that of other
+CSRGraph& CSRGraph::operator=(CSRGraph&& other) noexcept {
+  if (this != &other) {
+    if (mapping != nullptr) {
+      ::munmap(mapping, mappingSize);
+    } else {
+      delete[] offsets;
+      delete[] targets;
+      delete[] weights;
+    }
+    numVertices = other.numVertices;
+    numEntries = other.numEntries;
+    directed = other.directed;
+    offsets = other.offsets;
+    targets = other.targets;
+    weights = other.weights;
+    mapping = other.mapping;
+    mappingSize = other.mappingSize;
+    other.numVertices = 0;
+    other.numEntries = 0;
+    other.offsets = nullptr;
+    other.targets = nullptr;
+    other.weights = nullptr;
+    other.mapping = nullptr;
+    other.mappingSize = 0;
+  }
+  return *this;
+}
+
+//Write header, offsets, targets and weights in one pass over the arrays
+void CSRGraph::save(const char* path) const {
+  std::FILE* file = openForWriting(path, numVertices, numEntries, directed);
+  writeInts(file, offsets, (size_t)numVertices + 1);
+  writeInts(file, targets, (size_t)numEntries);
+  writeInts(file, weights, (size_t)numEntries);
+  finishWriting(file);
+}
+
+//Stream an adjacency list graph to disk: the offsets come from a degree
+//count, then targets and weights are written through a fixed buffer
+void CSRGraph::save(const Graph& g, const char* path) {
+  const int bufferSize = 1 << 14;
+  int n = g.getNumVertices();
+  int* rowOffsets = new int[n + 1];
+  rowOffsets[0] = 0;
+  for (int v = 0; v < n; ++v) {
+    int degree = 0;
+    for (Neighbor* nb = g.getNeighbors(v); nb != nullptr; nb = nb->next)
+      ++degree;
+    rowOffsets[v + 1] = rowOffsets[v] + degree;
+  }
+
+  int* buffer = new int[bufferSize];
+  std::FILE* file = nullptr;
+  try {
+    file = openForWriting(path, n, rowOffsets[n], g.isDirected());
+    writeInts(file, rowOffsets, (size_t)n + 1);
+
+    for (int pass = 0; pass < 2; ++pass) { //targets, then weights
+      int used = 0;
+      for (int v = 0; v < n; ++v) {
+        for (Neighbor* nb = g.getNeighbors(v); nb != nullptr; nb = nb->next) {
+          buffer[used++] = pass == 0 ? nb->vertex : nb->weight;
+          if (used == bufferSize) {
+            writeInts(file, buffer, used);
+            used = 0;
+          }
+        }
+      }
+      writeInts(file, buffer, used);
+    }
+    finishWriting(file);
+  } catch (...) {
+    delete[] rowOffsets;
+    delete[] buffer;
+    throw;
+  }
+  delete[] rowOffsets;
+  delete[] buffer;
+}
+
+//One pass over the offsets and the targets
+void CSRGraph::validate() const {
+  if (offsets[0] != 0 || offsets[numVertices] != numEntries) {
+    throw "Invalid graph file";
+  }
+  for (int v = 0; v < numVertices; ++v) {
+    if (offsets[v + 1] < offsets[v]) {
+      throw "Invalid graph file";
+    }
+  }
+  for (int i = 0; i < numEntries; ++i) {
+    if (targets[i] < 0 || targets[i] >= numVertices) {
+      throw "Invalid graph file";
+    }
+  }
+}
+
+//Function to check vertices index validity
+void CSRGraph::validateVertex(int v) const {
+  if (v < 0 || v >= numVertices) {
+    throw "Invalid vertex index";
+  }
+}
+
+//Method that returns the vertices number of the graph
+int CSRGraph::getNumVertices() const {
+  return numVertices;
+}
+
+//Method that returns the number of adjacency entries
+int CSRGraph::getNumEntries() const {
+  return numEntries;
+}
+
+//Method that tells whether rows hold out-neighbors only
+bool CSRGraph::isDirected() const {
+  return directed;
+}
+
+//Method that returns the number of neighbors of a vertex
+int CSRGraph::degree(int v) const {
+  validateVertex(v);
+  return offsets[v + 1] - offsets[v];
+}
+
+//Graph printing method (same layout as Graph::printGraph)
+void CSRGraph::printGraph() const {
+  std::cout << "Adjacency List:" << std::endl;
+  for (int v = 0; v < numVertices; ++v) {
+    std::cout << "  [" << v << "] --> ";
+    if (begin(v) == end(v)) {
+      std::cout << "(none)";
+    }
+    for (int i = begin(v); i < end(v); ++i) {
+      std::cout << targets[i] << " (w:" << weights[i] << ")";
+      if (i + 1 < end(v))
+        std::cout << " -> ";
+    }
+    std::cout << std::endl;
+  }
+}
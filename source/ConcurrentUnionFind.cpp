@@ -0,0 +1,64 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/ConcurrentUnionFind.hpp"
+
+using namespace graph;
+
+// Constructor: initialize each element to be its own parent
+ConcurrentUnionFind::ConcurrentUnionFind(int size) : size(size) {
+    parent = new std::atomic<int>[size];
+    for (int i = 0; i < size; ++i)
+        parent[i].store(i, std::memory_order_relaxed);
+}
+
+// Destructor: free allocated memory
+ConcurrentUnionFind::~ConcurrentUnionFind() {
+    delete[] parent;
+}
+
+// Walk to the root, pointing every node at its grandparent on the way
+// (path splitting: the walk moves to the old parent, so every node on the
+// path is repointed, not every other one as in path halving)
+int ConcurrentUnionFind::find(int x) {
+    while (true) {
+        int p = parent[x].load(std::memory_order_acquire);
+        if (p == x) return x;
+        int gp = parent[p].load(std::memory_order_acquire);
+        if (p != gp) {
+            // A lost race only means someone else shortened the path;
+            // p then holds x's current parent
+            parent[x].compare_exchange_weak(p, gp, std::memory_order_release, std::memory_order_relaxed);
+        }
+        x = p;
+    }
+}
+
+// Link the smaller-index root under the larger-index root
+bool ConcurrentUnionFind::unite(int x, int y) {
+    while (true) {
+        int rootX = find(x);
+        int rootY = find(y);
+        if (rootX == rootY) return false;  // already connected
+
+        if (rootX > rootY) {
+            int temp = rootX;
+            rootX = rootY;
+            rootY = temp;
+        }
+        int expected = rootX;
+        if (parent[rootX].compare_exchange_strong(expected, rootY, std::memory_order_acq_rel))
+            return true;
+        // rootX stopped being a root in the meantime: retry
+    }
+}
+
+// Same roots means connected; different roots are only conclusive if the
+// first one is still a root after reading the second
+bool ConcurrentUnionFind::connected(int x, int y) {
+    while (true) {
+        int rootX = find(x);
+        int rootY = find(y);
+        if (rootX == rootY) return true;
+        if (parent[rootX].load(std::memory_order_acquire) == rootX) return false;
+    }
+}
@@ -0,0 +1,162 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/Algorithms.hpp"
+#include "../include/Adjacency.hpp"
+#include "../include/Bitmap.hpp"
+
+using namespace graph;
+
+/*
+Direction-optimizing BFS (Beamer, Asanovic, Patterson):
+levels are expanded top-down (frontier vertices scan their neighbors)
+while the frontier is small, and bottom-up (every unvisited vertex looks
+for any neighbor in the frontier and stops at the first hit) while the
+frontier is large. Bottom-up skips most of the redundant edge checks of
+the middle levels of low-diameter graphs.
+
+Switching rule, with m_f = edges out of the frontier, m_u = edges out of
+unvisited vertices and n_f = frontier size:
+    top-down  -> bottom-up  when m_f > m_u / alpha
+    bottom-up -> top-down   when n_f < n / beta
+
+A directed graph only stores out-neighbors, so the bottom-up step (which
+needs in-neighbors) is never taken and the search stays top-down.
+
+The visiting order doubles as the frontier list: level d occupies
+order[levelStart, levelEnd). parentWeight[v] keeps the weight of the tree
+edge into v so the BFS tree can be built afterwards.
+*/
+template <typename G>
+void directionOptimizingCore(const G& g, int source, int alpha, int beta,
+                             TraversalResult& result, int* parentWeight) {
+    int n = g.getNumVertices();
+    int* order = result.order;
+    int* depth = result.depth;
+    int* parent = result.parent;
+
+    // Degrees drive the switching heuristic
+    int* degree = new int[n];
+    long long unexploredEdges = 0;
+    for (int u = 0; u < n; ++u) {
+        int d = 0;
+        for (auto it = neighbors(g, u); it.valid(); it.next())
+            ++d;
+        degree[u] = d;
+        unexploredEdges += d;
+    }
+
+    Bitmap frontier(n);
+
+    depth[source] = 0;
+    order[result.visitedCount++] = source;
+    unexploredEdges -= degree[source];
+
+    int levelStart = 0;
+    int level = 0;
+    bool bottomUp = false;
+
+    while (levelStart < result.visitedCount) {
+        int levelEnd = result.visitedCount;
+        int frontierSize = levelEnd - levelStart;
+
+        long long frontierEdges = 0;
+        for (int i = levelStart; i < levelEnd; ++i)
+            frontierEdges += degree[order[i]];
+
+        if (!bottomUp && !g.isDirected() && frontierEdges > unexploredEdges / alpha)
+            bottomUp = true;
+        else if (bottomUp && frontierSize < n / beta)
+            bottomUp = false;
+
+        if (bottomUp) {
+            frontier.reset();
+            for (int i = levelStart; i < levelEnd; ++i)
+                frontier.set(order[i]);
+
+            for (int v = 0; v < n; ++v) {
+                if (depth[v] != -1) continue;
+                for (auto it = neighbors(g, v); it.valid(); it.next()) {
+                    if (frontier.test(it.vertex())) {
+                        depth[v] = level + 1;
+                        parent[v] = it.vertex();
+                        parentWeight[v] = it.weight();
+                        order[result.visitedCount++] = v;
+                        unexploredEdges -= degree[v];
+                        break;
+                    }
+                }
+            }
+        } else {
+            for (int i = levelStart; i < levelEnd; ++i) {
+                int u = order[i];
+                for (auto it = neighbors(g, u); it.valid(); it.next()) {
+                    int v = it.vertex();
+                    if (depth[v] == -1) {
+                        depth[v] = level + 1;
+                        parent[v] = u;
+                        parentWeight[v] = it.weight();
+                        order[result.visitedCount++] = v;
+                        unexploredEdges -= degree[v];
+                    }
+                }
+            }
+        }
+
+        levelStart = levelEnd;
+        ++level;
+    }
+
+    delete[] degree;
+}
+
+template <typename G>
+TraversalResult directionOptimizingTraversalImpl(const G& g, int source, int alpha, int beta) {
+    g.validateVertex(source);
+    if (alpha <= 0 || beta <= 0)
+        throw "Invalid direction-optimizing BFS parameters";
+
+    int n = g.getNumVertices();
+    TraversalResult result(n, source);
+    int* parentWeight = new int[n];
+    directionOptimizingCore(g, source, alpha, beta, result, parentWeight);
+    delete[] parentWeight;
+    return result;
+}
+
+template <typename G>
+Graph directionOptimizingImpl(const G& g, int source, int alpha, int beta) {
+    g.validateVertex(source);
+    if (alpha <= 0 || beta <= 0)
+        throw "Invalid direction-optimizing BFS parameters";
+
+    int n = g.getNumVertices();
+    TraversalResult result(n, source);
+    int* parentWeight = new int[n];
+    directionOptimizingCore(g, source, alpha, beta, result, parentWeight);
+
+    // Tree edges in visiting (level) order
+    Graph tree(n, g.isDirected());
+    for (int i = 1; i < result.visitedCount; ++i) {
+        int v = result.order[i];
+        tree.addEdge(result.parent[v], v, parentWeight[v]);
+    }
+
+    delete[] parentWeight;
+    return tree;
+}
+
+Graph Algorithms::bfsDirectionOptimizing(const Graph& g, int source, int alpha, int beta) {
+    return directionOptimizingImpl(g, source, alpha, beta);
+}
+
+Graph Algorithms::bfsDirectionOptimizing(const CSRGraph& g, int source, int alpha, int beta) {
+    return directionOptimizingImpl(g, source, alpha, beta);
+}
+
+TraversalResult Algorithms::bfsDirectionOptimizingTraversal(const Graph& g, int source, int alpha, int beta) {
+    return directionOptimizingTraversalImpl(g, source, alpha, beta);
+}
+
+TraversalResult Algorithms::bfsDirectionOptimizingTraversal(const CSRGraph& g, int source, int alpha, int beta) {
+    return directionOptimizingTraversalImpl(g, source, alpha, beta);
+}
@@ -0,0 +1,307 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/DynamicConnectivity.hpp"
+#include "../include/RollbackUnionFind.hpp"
+
+using namespace graph;
+
+DynamicConnectivity::DynamicConnectivity(int numVertices)
+    : numVertices(numVertices), log(nullptr), logSize(0), logCapacity(0),
+      numQueries(0), answers(nullptr), counts(nullptr), countCapacity(0), countSize(0) {
+    if (numVertices < 0)
+        throw "Invalid graph size";
+}
+
+DynamicConnectivity::~DynamicConnectivity() {
+    delete[] log;
+    delete[] answers;
+    delete[] counts;
+}
+
+//Function to check vertices index validity
+void DynamicConnectivity::validateVertex(int v) const {
+    if (v < 0 || v >= numVertices) {
+        throw "Invalid vertex index";
+    }
+}
+
+// Append an operation, doubling the log when full; returns its time
+int DynamicConnectivity::append(OpType type, int u, int v) {
+    validateVertex(u);
+    validateVertex(v);
+    if (logSize == logCapacity) {
+        logCapacity = logCapacity == 0 ? 16 : 2 * logCapacity;
+        Operation* grown = new Operation[logCapacity];
+        for (int i = 0; i < logSize; ++i)
+            grown[i] = log[i];
+        delete[] log;
+        log = grown;
+    }
+    if (u > v) {
+        int temp = u;
+        u = v;
+        v = temp;
+    }
+    log[logSize] = {type, u, v};
+    return logSize++;
+}
+
+// Linear probing from the hash of u-v; counts must be allocated
+int DynamicConnectivity::probe(int u, int v) const {
+    unsigned long long key = ((unsigned long long)(unsigned)u << 32) | (unsigned)v;
+    key *= 0x9E3779B97F4A7C15ULL;
+    int mask = countCapacity - 1;
+    int slot = (int)(key >> 32) & mask;
+    while (counts[slot].used && (counts[slot].u != u || counts[slot].v != v))
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+// Find (or create with count 0) the slot of u-v, doubling the table
+// before it gets more than half full; u and v must be ordered
+int& DynamicConnectivity::liveCopies(int u, int v) {
+    if (2 * (countSize + 1) > countCapacity) {
+        EdgeCount* old = counts;
+        int oldCapacity = countCapacity;
+        countCapacity = countCapacity == 0 ? 16 : 2 * countCapacity;
+        counts = new EdgeCount[countCapacity]();
+        countSize = 0;
+        for (int i = 0; i < oldCapacity; ++i)
+            if (old[i].used) liveCopies(old[i].u, old[i].v) = old[i].count;
+        delete[] old;
+    }
+    int slot = probe(u, v);
+    if (!counts[slot].used) {
+        counts[slot] = {u, v, 0, true};
+        ++countSize;
+    }
+    return counts[slot].count;
+}
+
+// Lookup without inserting; u and v must be ordered
+int* DynamicConnectivity::findCopies(int u, int v) {
+    if (countCapacity == 0) return nullptr;
+    int slot = probe(u, v);
+    return counts[slot].used ? &counts[slot].count : nullptr;
+}
+
+void DynamicConnectivity::addEdge(int u, int v) {
+    int t = append(OpType::Add, u, v);
+    ++liveCopies(log[t].u, log[t].v);
+}
+
+void DynamicConnectivity::removeEdge(int u, int v) {
+    validateVertex(u);
+    validateVertex(v);
+    int* copies = u <= v ? findCopies(u, v) : findCopies(v, u);
+    if (copies == nullptr || *copies == 0)
+        throw "Removing an edge that does not exist";
+    --*copies;
+    append(OpType::Remove, u, v);
+}
+
+int DynamicConnectivity::query(int u, int v) {
+    append(OpType::Query, u, v);
+    return numQueries++;
+}
+
+int DynamicConnectivity::getNumQueries() const {
+    return numQueries;
+}
+
+bool DynamicConnectivity::answer(int queryId) const {
+    if (answers == nullptr)
+        throw "Queries are not solved yet";
+    if (queryId < 0 || queryId >= numQueries)
+        throw "Invalid query id";
+    return answers[queryId];
+}
+
+// ----------------------------------------------------------
+// Solving
+// ----------------------------------------------------------
+
+namespace {
+
+// Time interval [begin, end) during which one copy of u-v exists
+struct Interval {
+    int u, v;
+    int begin, end;
+};
+
+// Orders update times by (u, v, time) so adds and removes of the same
+// edge become adjacent and chronological
+bool updateLess(const int* times, const int* us, const int* vs, int a, int b) {
+    if (us[a] != us[b]) return us[a] < us[b];
+    if (vs[a] != vs[b]) return vs[a] < vs[b];
+    return times[a] < times[b];
+}
+
+// Bottom-up merge sort of the index array idx[0..count)
+void sortUpdates(int* idx, int count, const int* times, const int* us, const int* vs) {
+    int* buffer = new int[count];
+    for (int width = 1; width < count; width *= 2) {
+        for (int left = 0; left < count; left += 2 * width) {
+            int mid = left + width < count ? left + width : count;
+            int right = left + 2 * width < count ? left + 2 * width : count;
+            int i = left, j = mid, k = left;
+            while (i < mid && j < right)
+                buffer[k++] = updateLess(times, us, vs, idx[j], idx[i]) ? idx[j++] : idx[i++];
+            while (i < mid) buffer[k++] = idx[i++];
+            while (j < right) buffer[k++] = idx[j++];
+        }
+        for (int i = 0; i < count; ++i)
+            idx[i] = buffer[i];
+    }
+    delete[] buffer;
+}
+
+/*
+Segment tree over time [0, T) stored like a CSR graph: the intervals
+assigned to node x are items[offsets[x], offsets[x + 1]). It is filled in
+two passes over the intervals - count, then place.
+*/
+class TimeSegmentTree {
+public:
+    int timeSpan;
+    int* offsets;
+    int* items;    // interval indices
+    int* cursor;
+
+    TimeSegmentTree(int timeSpan) : timeSpan(timeSpan), items(nullptr) {
+        offsets = new int[4 * timeSpan + 1]();
+        cursor = new int[4 * timeSpan]();
+    }
+
+    ~TimeSegmentTree() {
+        delete[] offsets;
+        delete[] items;
+        delete[] cursor;
+    }
+
+    // Visit the canonical cover of [begin, end); counting pass or placing pass
+    void cover(int node, int lo, int hi, int begin, int end, int item, bool place) {
+        if (end <= lo || hi <= begin) return;
+        if (begin <= lo && hi <= end) {
+            if (place) items[cursor[node]++] = item;
+            else ++offsets[node + 1];
+            return;
+        }
+        int mid = (lo + hi) / 2;
+        cover(2 * node + 1, lo, mid, begin, end, item, place);
+        cover(2 * node + 2, mid, hi, begin, end, item, place);
+    }
+
+    // Turn per-node counts into offsets and allocate the items
+    void finishCounting() {
+        for (int x = 0; x < 4 * timeSpan; ++x) {
+            offsets[x + 1] += offsets[x];
+            cursor[x] = offsets[x];
+        }
+        items = new int[offsets[4 * timeSpan]];
+    }
+};
+
+// DFS over the time tree: unite the node's edges, recurse, undo
+void answerQueries(const TimeSegmentTree& tree, int node, int lo, int hi,
+                   const Interval* intervals, RollbackUnionFind& uf,
+                   const int* queryAt, const int* queryU, const int* queryV, bool* answers) {
+    int mark = uf.snapshot();
+    for (int i = tree.offsets[node]; i < tree.offsets[node + 1]; ++i) {
+        const Interval& e = intervals[tree.items[i]];
+        uf.unite(e.u, e.v);
+    }
+
+    if (hi - lo == 1) {
+        int q = queryAt[lo];
+        if (q != -1) answers[q] = uf.connected(queryU[q], queryV[q]);
+    } else {
+        int mid = (lo + hi) / 2;
+        answerQueries(tree, 2 * node + 1, lo, mid, intervals, uf, queryAt, queryU, queryV, answers);
+        answerQueries(tree, 2 * node + 2, mid, hi, intervals, uf, queryAt, queryU, queryV, answers);
+    }
+
+    uf.rollback(mark);
+}
+
+}
+
+void DynamicConnectivity::solve() {
+    int T = logSize;
+    delete[] answers;
+    answers = new bool[numQueries]();
+    if (T == 0) return;
+
+    // Split the log into updates and queries
+    int updateCount = 0;
+    for (int t = 0; t < T; ++t)
+        if (log[t].type != OpType::Query) ++updateCount;
+
+    int* times = new int[updateCount];
+    int* us = new int[updateCount];
+    int* vs = new int[updateCount];
+    int* idx = new int[updateCount];
+    int* queryAt = new int[T];   // queryAt[t] = query id at time t, or -1
+    int* queryU = new int[numQueries];
+    int* queryV = new int[numQueries];
+
+    int k = 0, q = 0;
+    for (int t = 0; t < T; ++t) {
+        queryAt[t] = -1;
+        if (log[t].type == OpType::Query) {
+            queryU[q] = log[t].u;
+            queryV[q] = log[t].v;
+            queryAt[t] = q++;
+        } else {
+            times[k] = t;
+            us[k] = log[t].u;
+            vs[k] = log[t].v;
+            idx[k] = k;
+            ++k;
+        }
+    }
+
+    // Pair every removal with an open insertion of the same edge
+    sortUpdates(idx, updateCount, times, us, vs);
+    Interval* intervals = new Interval[updateCount];
+    int* open = new int[updateCount];   // insertion times of the current edge, as a stack
+    int intervalCount = 0;
+
+    // removeEdge rejects absent edges, so every removal finds an open copy
+    for (int start = 0; start < updateCount;) {
+        int end = start;
+        int openCount = 0;
+        while (end < updateCount && us[idx[end]] == us[idx[start]] && vs[idx[end]] == vs[idx[start]]) {
+            int i = idx[end];
+            if (log[times[i]].type == OpType::Add)
+                open[openCount++] = times[i];
+            else
+                intervals[intervalCount++] = {us[i], vs[i], open[--openCount], times[i]};
+            ++end;
+        }
+        // Copies never removed live until the end of the log
+        while (openCount > 0)
+            intervals[intervalCount++] = {us[idx[start]], vs[idx[start]], open[--openCount], T};
+        start = end;
+    }
+
+    TimeSegmentTree tree(T);
+    for (int i = 0; i < intervalCount; ++i)
+        tree.cover(0, 0, T, intervals[i].begin, intervals[i].end, i, false);
+    tree.finishCounting();
+    for (int i = 0; i < intervalCount; ++i)
+        tree.cover(0, 0, T, intervals[i].begin, intervals[i].end, i, true);
+
+    RollbackUnionFind uf(numVertices);
+    answerQueries(tree, 0, 0, T, intervals, uf, queryAt, queryU, queryV, answers);
+
+    delete[] open;
+    delete[] intervals;
+    delete[] times;
+    delete[] us;
+    delete[] vs;
+    delete[] idx;
+    delete[] queryAt;
+    delete[] queryU;
+    delete[] queryV;
+}
@@ -0,0 +1,102 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/EdgeIndex.hpp"
+
+using namespace graph;
+
+template <typename VertexT, typename WeightT>
+BasicEdgeIndex<VertexT, WeightT>::BasicEdgeIndex(size_t expectedEntries) : size(0) {
+    capacity = 16;
+    while (capacity < 2 * expectedEntries)
+        capacity *= 2;
+    table = new Entry[capacity];
+    used = new bool[capacity]();
+}
+
+template <typename VertexT, typename WeightT>
+BasicEdgeIndex<VertexT, WeightT>::~BasicEdgeIndex() {
+    delete[] table;
+    delete[] used;
+}
+
+// Home slot of a key: 64-bit mix of both ids, then mask
+template <typename VertexT, typename WeightT>
+size_t BasicEdgeIndex<VertexT, WeightT>::slotOf(VertexT u, VertexT v) const {
+    unsigned long long h = (unsigned long long)u * 0x9e3779b97f4a7c15ULL ^ (unsigned long long)v;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (size_t)(h & (capacity - 1));
+}
+
+// Double the table and reinsert every entry
+template <typename VertexT, typename WeightT>
+void BasicEdgeIndex<VertexT, WeightT>::grow() {
+    Entry* oldTable = table;
+    bool* oldUsed = used;
+    size_t oldCapacity = capacity;
+    capacity *= 2;
+    table = new Entry[capacity];
+    used = new bool[capacity]();
+
+    for (size_t i = 0; i < oldCapacity; ++i) {
+        if (!oldUsed[i]) continue;
+        size_t slot = slotOf(oldTable[i].u, oldTable[i].v);
+        while (used[slot])
+            slot = (slot + 1) & (capacity - 1);
+        table[slot] = oldTable[i];
+        used[slot] = true;
+    }
+    delete[] oldTable;
+    delete[] oldUsed;
+}
+
+template <typename VertexT, typename WeightT>
+typename BasicEdgeIndex<VertexT, WeightT>::Entry* BasicEdgeIndex<VertexT, WeightT>::find(VertexT u, VertexT v) const {
+    for (size_t slot = slotOf(u, v);; slot = (slot + 1) & (capacity - 1)) {
+        if (!used[slot]) return nullptr;
+        if (table[slot].u == u && table[slot].v == v) return &table[slot];
+    }
+}
+
+template <typename VertexT, typename WeightT>
+typename BasicEdgeIndex<VertexT, WeightT>::Entry* BasicEdgeIndex<VertexT, WeightT>::findOrAdd(VertexT u, VertexT v) {
+    if (2 * (size + 1) > capacity) grow();
+    size_t slot = slotOf(u, v);
+    while (used[slot]) {
+        if (table[slot].u == u && table[slot].v == v) return &table[slot];
+        slot = (slot + 1) & (capacity - 1);
+    }
+    table[slot] = {u, v, nullptr, 0};
+    used[slot] = true;
+    ++size;
+    return &table[slot];
+}
+
+// Backward-shift deletion: pull later entries of the probe run into the
+// hole whenever their home slot does not lie between the hole and them
+template <typename VertexT, typename WeightT>
+void BasicEdgeIndex<VertexT, WeightT>::erase(VertexT u, VertexT v) {
+    Entry* entry = find(u, v);
+    if (entry == nullptr) return;
+
+    size_t hole = (size_t)(entry - table);
+    size_t mask = capacity - 1;
+    for (size_t slot = (hole + 1) & mask; used[slot]; slot = (slot + 1) & mask) {
+        size_t home = slotOf(table[slot].u, table[slot].v);
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            table[hole] = table[slot];
+            hole = slot;
+        }
+    }
+    used[hole] = false;
+    --size;
+}
+
+template <typename VertexT, typename WeightT>
+size_t BasicEdgeIndex<VertexT, WeightT>::getSize() const {
+    return size;
+}
+
+#define GRAPH_INSTANTIATE_EDGE_INDEX(V, W) template class graph::BasicEdgeIndex<V, W>;
+GRAPH_FOR_EACH_TYPE_PAIR(GRAPH_INSTANTIATE_EDGE_INDEX)
@@ -0,0 +1,247 @@
+// Author: realyoavperetz@gmail.com
+
+#include <climits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../include/EdgeListLoader.hpp"
+#include "../include/Parallel.hpp"
+
+using namespace graph;
+
+namespace {
+
+// Smallest chunk worth a thread of its own
+const long long MIN_CHUNK_BYTES = 1 << 20;
+
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Edges parsed by one thread, grown by doubling
+struct EdgeBuffer {
+    Edge* edges = nullptr;
+    int count = 0;
+    int capacity = 0;
+    int maxVertex = -1;
+    const char* errorAt = nullptr;   // start of the first malformed token, if any
+
+    ~EdgeBuffer() { delete[] edges; }
+
+    void push(int u, int v, int w) {
+        if (count == capacity) {
+            capacity = capacity == 0 ? 1024 : 2 * capacity;
+            Edge* grown = new Edge[capacity];
+            for (int i = 0; i < count; ++i)
+                grown[i] = edges[i];
+            delete[] edges;
+            edges = grown;
+        }
+        edges[count++] = {u, v, w};
+        if (u > maxVertex) maxVertex = u;
+        if (v > maxVertex) maxVertex = v;
+    }
+};
+
+// Skip blanks and comments up to the first token; returns end if none
+const char* skipBlank(const char* p, const char* end) {
+    while (p < end) {
+        if (isSpace(*p)) {
+            ++p;
+        } else if (*p == '#') {
+            while (p < end && *p != '\n') ++p;
+        } else {
+            break;
+        }
+    }
+    return p;
+}
+
+// Skip spaces and tabs without leaving the line
+inline const char* skipInline(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    return p;
+}
+
+// Parse one decimal int at p; the token must end at whitespace, a comment
+// or end. Returns the position after it, or nullptr if malformed.
+const char* parseInt(const char* p, const char* end, int& value) {
+    bool negative = false;
+    if (p < end && *p == '-') {
+        negative = true;
+        ++p;
+    }
+    const char* digits = p;
+    long long result = 0;
+    while (p < end && (unsigned)(*p - '0') < 10u) {
+        result = result * 10 + (*p - '0');
+        if (result > (long long)INT_MAX + 1) return nullptr;
+        ++p;
+    }
+    if (p == digits) return nullptr;
+    if (p < end && !isSpace(*p) && *p != '#') return nullptr;
+    if (negative) result = -result;
+    if (result > INT_MAX) return nullptr;
+    value = (int)result;
+    return p;
+}
+
+// Parse every "u v w" line in [p, end)
+void parseChunk(const char* p, const char* end, EdgeBuffer& out) {
+    out.capacity = (int)((end - p) / 16) + 16; // typical lines are 16+ bytes, doubling covers the rest
+    out.edges = new Edge[out.capacity];
+
+    int fields[3];
+    while (true) {
+        p = skipBlank(p, end);
+        if (p == end) return;
+        const char* line = p;
+        for (int f = 0; f < 3; ++f) {
+            if (f > 0) p = skipInline(p, end);
+            p = parseInt(p, end, fields[f]);
+            if (p == nullptr || (f < 2 && fields[f] < 0)) {
+                out.errorAt = line;
+                return;
+            }
+        }
+        //Nothing but a comment may follow the weight
+        p = skipInline(p, end);
+        if (p < end && *p == '#') {
+            while (p < end && *p != '\n') ++p;
+        }
+        if (p < end && *p != '\n') {
+            out.errorAt = line;
+            return;
+        }
+        out.push(fields[0], fields[1], fields[2]);
+    }
+}
+
+// Start of the line containing or following position offset
+const char* lineStart(const char* data, long long size, long long offset) {
+    if (offset <= 0) return data;
+    if (offset >= size) return data + size;
+    const char* p = data + offset;
+    while (p < data + size && p[-1] != '\n') ++p;
+    return p;
+}
+
+// 1-based number of the line starting at errorAt
+long long lineNumber(const char* data, const char* errorAt) {
+    long long line = 1;
+    for (const char* p = data; p < errorAt; ++p)
+        if (*p == '\n') ++line;
+    return line;
+}
+
+// Map and parse the file into one buffer per chunk, in file order. Sets
+// threads to the number of buffers, numVertices and edgeCount to the totals.
+EdgeBuffer* parseBuffers(const char* path, int numThreads, long long* errorLine, int& threads,
+                         int& numVertices, int& edgeCount) {
+    if (errorLine != nullptr) *errorLine = 0;
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        throw "Failed to open edge list";
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw "Failed to open edge list";
+    }
+    long long size = info.st_size;
+    const char* data = nullptr;
+    if (size > 0) {
+        void* mapped = ::mmap(nullptr, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            ::close(fd);
+            throw "Failed to open edge list";
+        }
+        ::madvise(mapped, (size_t)size, MADV_SEQUENTIAL);
+        data = (const char*)mapped;
+    }
+    ::close(fd);
+
+    threads = resolveThreadCount(numThreads);
+    long long maxThreads = size / MIN_CHUNK_BYTES + 1;
+    if (threads > maxThreads) threads = (int)maxThreads;
+
+    //Parse the chunks, each starting at a line boundary
+    EdgeBuffer* buffers = new EdgeBuffer[threads];
+    runParallel(threads, [&](int t) {
+        const char* begin = lineStart(data, size, size * t / threads);
+        const char* end = lineStart(data, size, size * (t + 1) / threads);
+        if (begin < end) parseChunk(begin, end, buffers[t]);
+    });
+
+    const char* errorAt = nullptr;
+    long long total = 0;
+    int maxVertex = -1;
+    for (int t = 0; t < threads; ++t) {
+        if (errorAt == nullptr) errorAt = buffers[t].errorAt;
+        total += buffers[t].count;
+        if (buffers[t].maxVertex > maxVertex) maxVertex = buffers[t].maxVertex;
+    }
+    if (errorAt != nullptr || total > INT_MAX / 2 || maxVertex == INT_MAX) {
+        if (errorAt != nullptr && errorLine != nullptr) *errorLine = lineNumber(data, errorAt);
+        delete[] buffers;
+        if (data != nullptr) ::munmap((void*)data, (size_t)size);
+        throw "Invalid edge list";
+    }
+    if (data != nullptr) ::munmap((void*)data, (size_t)size);
+
+    numVertices = maxVertex + 1;
+    edgeCount = (int)total;
+    return buffers;
+}
+
+}
+
+Edge* graph::parseEdgeList(const char* path, int& numVertices, int& edgeCount, int numThreads,
+                           long long* errorLine) {
+    int threads;
+    EdgeBuffer* buffers = parseBuffers(path, numThreads, errorLine, threads, numVertices, edgeCount);
+
+    //Concatenate in file order, one copy per thread
+    Edge* edges = new Edge[edgeCount];
+    int* starts = new int[threads];
+    int offset = 0;
+    for (int t = 0; t < threads; ++t) {
+        starts[t] = offset;
+        offset += buffers[t].count;
+    }
+    runParallel(threads, [&](int t) {
+        Edge* out = edges + starts[t];
+        for (int i = 0; i < buffers[t].count; ++i)
+            out[i] = buffers[t].edges[i];
+    });
+
+    delete[] starts;
+    delete[] buffers;
+    return edges;
+}
+
+//The CSR is filled straight from the per-thread buffers; their edges are
+//never gathered into one array
+CSRGraph graph::loadEdgeList(const char* path, int numThreads, long long* errorLine) {
+    int threads, numVertices, edgeCount;
+    EdgeBuffer* buffers = parseBuffers(path, numThreads, errorLine, threads, numVertices, edgeCount);
+    const Edge** chunks = new const Edge*[threads];
+    int* chunkSizes = new int[threads];
+    for (int t = 0; t < threads; ++t) {
+        chunks[t] = buffers[t].edges;
+        chunkSizes[t] = buffers[t].count;
+    }
+    try {
+        CSRGraph g(numVertices, chunks, chunkSizes, threads);
+        delete[] chunks;
+        delete[] chunkSizes;
+        delete[] buffers;
+        return g;
+    } catch (...) {
+        delete[] chunks;
+        delete[] chunkSizes;
+        delete[] buffers;
+        throw;
+    }
+}
@@ -0,0 +1,255 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/EdgeSort.hpp"
+#include "../include/Parallel.hpp"
+#include <cstdint>
+
+using namespace graph;
+
+// Merge function for Merge Sort
+static void merge(Edge* arr, int left, int mid, int right) {
+    int n1 = mid - left + 1;
+    int n2 = right - mid;
+
+    Edge* L = new Edge[n1];
+    Edge* R = new Edge[n2];
+
+    for (int i = 0; i < n1; ++i) L[i] = arr[left + i];
+    for (int j = 0; j < n2; ++j) R[j] = arr[mid + 1 + j];
+
+    int i = 0, j = 0, k = left;
+
+    while (i < n1 && j < n2) {
+        if (L[i].weight <= R[j].weight)
+            arr[k++] = L[i++];
+        else
+            arr[k++] = R[j++];
+    }
+
+    while (i < n1) arr[k++] = L[i++];
+    while (j < n2) arr[k++] = R[j++];
+
+    delete[] L;
+    delete[] R;
+}
+
+// Merge Sort on array of edges
+void graph::mergeSort(Edge* arr, int left, int right) {
+    if (left < right) {
+        int mid = left + (right - left) / 2;
+        mergeSort(arr, left, mid);
+        mergeSort(arr, mid + 1, right);
+        merge(arr, left, mid, right);
+    }
+}
+
+// Ranges at most this long are finished by insertion sort
+static const int INSERTION_SORT_LIMIT = 16;
+
+static void swapEdges(Edge& a, Edge& b) {
+    Edge temp = a;
+    a = b;
+    b = temp;
+}
+
+// Insertion sort of edges[0..count)
+static void insertionSort(Edge* edges, int count) {
+    for (int i = 1; i < count; ++i) {
+        Edge e = edges[i];
+        int j = i - 1;
+        while (j >= 0 && edgeLess(e, edges[j])) {
+            edges[j + 1] = edges[j];
+            --j;
+        }
+        edges[j + 1] = e;
+    }
+}
+
+// Restore the max-heap below index i of edges[0..count)
+static void siftDown(Edge* edges, int i, int count) {
+    while (true) {
+        int largest = i;
+        int left = 2 * i + 1;
+        int right = left + 1;
+        if (left < count && edgeLess(edges[largest], edges[left])) largest = left;
+        if (right < count && edgeLess(edges[largest], edges[right])) largest = right;
+        if (largest == i) return;
+        swapEdges(edges[i], edges[largest]);
+        i = largest;
+    }
+}
+
+// Heap sort of edges[0..count): O(count log count) in the worst case
+static void heapSort(Edge* edges, int count) {
+    for (int i = count / 2 - 1; i >= 0; --i)
+        siftDown(edges, i, count);
+    for (int end = count - 1; end > 0; --end) {
+        swapEdges(edges[0], edges[end]);
+        siftDown(edges, 0, end);
+    }
+}
+
+static void introSort(Edge* edges, int count, int depthLimit) {
+    while (count > INSERTION_SORT_LIMIT) {
+        if (depthLimit-- == 0) {
+            heapSort(edges, count);
+            return;
+        }
+
+        // Median of three as pivot, moved to the end
+        int mid = count / 2;
+        int last = count - 1;
+        if (edgeLess(edges[mid], edges[0])) swapEdges(edges[mid], edges[0]);
+        if (edgeLess(edges[last], edges[0])) swapEdges(edges[last], edges[0]);
+        if (edgeLess(edges[mid], edges[last])) swapEdges(edges[mid], edges[last]);
+        Edge pivot = edges[last];
+
+        int store = 0;
+        for (int i = 0; i < last; ++i)
+            if (edgeLess(edges[i], pivot)) swapEdges(edges[i], edges[store++]);
+        swapEdges(edges[store], edges[last]);
+
+        // Recurse into the smaller side, loop on the larger one
+        if (store < count - store - 1) {
+            introSort(edges, store, depthLimit);
+            edges += store + 1;
+            count -= store + 1;
+        } else {
+            introSort(edges + store + 1, count - store - 1, depthLimit);
+            count = store;
+        }
+    }
+    insertionSort(edges, count);
+}
+
+void graph::sortEdges(Edge* edges, int count) {
+    int depthLimit = 0;
+    for (int c = count; c > 1; c >>= 1)
+        depthLimit += 2;
+    introSort(edges, count, depthLimit);
+}
+
+// Below this many edges the radix sort runs on one thread
+static const int PARALLEL_SORT_MIN = 1 << 16;
+
+// Signed keys are mapped to unsigned ones that sort in the same order
+static uint32_t biased(int key) {
+    return static_cast<uint32_t>(key) ^ 0x80000000u;
+}
+
+struct WeightKey {
+    uint32_t operator()(const Edge& e) const { return biased(e.weight); }
+};
+
+struct SourceKey {
+    uint32_t operator()(const Edge& e) const { return biased(e.u); }
+};
+
+struct TargetKey {
+    uint32_t operator()(const Edge& e) const { return biased(e.v); }
+};
+
+/*
+One stable LSD radix sort by key(e), 8 bits per pass, from src into src
+(dst is scratch space of the same size).
+
+Each thread owns a contiguous chunk. Per pass, the threads count the
+digits of their chunk, thread 0 turns the counts into output offsets
+ordered by (digit, thread) - which keeps equal digits in input order -
+and every thread scatters its chunk. Bytes that are the same in every
+key are found up front and their passes skipped.
+*/
+template <typename Key>
+static void radixSortBy(Edge* src, Edge* dst, int count, int numThreads, Key key) {
+    if (count < PARALLEL_SORT_MIN) numThreads = 1;
+
+    // Bits that differ between keys: (OR of keys) & ~(AND of keys)
+    uint32_t* orBits = new uint32_t[numThreads];
+    uint32_t* andBits = new uint32_t[numThreads];
+    runParallel(numThreads, [&](int t) {
+        int begin = static_cast<int>(static_cast<long long>(count) * t / numThreads);
+        int end = static_cast<int>(static_cast<long long>(count) * (t + 1) / numThreads);
+        uint32_t o = 0, a = 0xffffffffu;
+        for (int i = begin; i < end; ++i) {
+            o |= key(src[i]);
+            a &= key(src[i]);
+        }
+        orBits[t] = o;
+        andBits[t] = a;
+    });
+    uint32_t varying = 0, allAnd = 0xffffffffu;
+    for (int t = 0; t < numThreads; ++t) {
+        varying |= orBits[t];
+        allAnd &= andBits[t];
+    }
+    varying &= ~allAnd;
+    delete[] orBits;
+    delete[] andBits;
+
+    int* offsets = new int[numThreads * 256];
+    Edge* from = src;
+    Edge* to = dst;
+    Barrier barrier(numThreads);
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        if (((varying >> shift) & 0xff) == 0) continue;
+
+        runParallel(numThreads, [&](int t) {
+            int begin = static_cast<int>(static_cast<long long>(count) * t / numThreads);
+            int end = static_cast<int>(static_cast<long long>(count) * (t + 1) / numThreads);
+            int* local = offsets + t * 256;
+
+            for (int d = 0; d < 256; ++d)
+                local[d] = 0;
+            for (int i = begin; i < end; ++i)
+                ++local[(key(from[i]) >> shift) & 0xff];
+
+            barrier.wait();
+            if (t == 0) {
+                int running = 0;
+                for (int d = 0; d < 256; ++d) {
+                    for (int th = 0; th < numThreads; ++th) {
+                        int c = offsets[th * 256 + d];
+                        offsets[th * 256 + d] = running;
+                        running += c;
+                    }
+                }
+            }
+            barrier.wait();
+
+            for (int i = begin; i < end; ++i)
+                to[local[(key(from[i]) >> shift) & 0xff]++] = from[i];
+        });
+
+        Edge* temp = from;
+        from = to;
+        to = temp;
+    }
+
+    // An odd number of passes leaves the result in the scratch buffer
+    if (from != src) {
+        runParallel(numThreads, [&](int t) {
+            int begin = static_cast<int>(static_cast<long long>(count) * t / numThreads);
+            int end = static_cast<int>(static_cast<long long>(count) * (t + 1) / numThreads);
+            for (int i = begin; i < end; ++i)
+                src[i] = from[i];
+        });
+    }
+
+    delete[] offsets;
+}
+
+void graph::radixSortEdges(Edge* edges, int count, int numThreads) {
+    Edge* buffer = new Edge[count];
+    radixSortBy(edges, buffer, count, resolveThreadCount(numThreads), WeightKey());
+    delete[] buffer;
+}
+
+void graph::radixSortEdgesTotal(Edge* edges, int count, int numThreads) {
+    numThreads = resolveThreadCount(numThreads);
+    Edge* buffer = new Edge[count];
+    radixSortBy(edges, buffer, count, numThreads, TargetKey());
+    radixSortBy(edges, buffer, count, numThreads, SourceKey());
+    radixSortBy(edges, buffer, count, numThreads, WeightKey());
+    delete[] buffer;
+}
@@ -1,57 +1,241 @@
 //Author: realyoavperetz@gmail.com
 
 #include <iostream> 
+#include <new>
+#include <utility>
 #include "../include/Graph.hpp" 
+#include "../include/EdgeIndex.hpp"
 
 using namespace graph; 
 
+//Block sizes double from the first to the last value
+static const size_t FIRST_BLOCK_NODES = 32;
+static const size_t MAX_BLOCK_NODES = 1 << 16;
+
+template <typename VertexT, typename WeightT>
+BasicNeighborPool<VertexT, WeightT>::BasicNeighborPool() : blocks(nullptr), freeList(nullptr), nextCapacity(FIRST_BLOCK_NODES) {}
+
+template <typename VertexT, typename WeightT>
+BasicNeighborPool<VertexT, WeightT>::~BasicNeighborPool(){
+  release();
+}
+
+//Free every block at once (Neighbor has no destructor to run)
+template <typename VertexT, typename WeightT>
+void BasicNeighborPool<VertexT, WeightT>::release(){
+  while (blocks != nullptr){
+    Block* temp = blocks;
+    blocks = blocks->next;
+    ::operator delete(temp->nodes);
+    delete temp;
+  }
+  freeList = nullptr;
+  nextCapacity = FIRST_BLOCK_NODES;
+}
+
+template <typename VertexT, typename WeightT>
+BasicNeighborPool<VertexT, WeightT>::BasicNeighborPool(BasicNeighborPool&& other) noexcept
+    : blocks(other.blocks), freeList(other.freeList), nextCapacity(other.nextCapacity){
+  other.blocks = nullptr;
+  other.freeList = nullptr;
+  other.nextCapacity = FIRST_BLOCK_NODES;
+}
+
+template <typename VertexT, typename WeightT>
+BasicNeighborPool<VertexT, WeightT>& BasicNeighborPool<VertexT, WeightT>::operator=(BasicNeighborPool&& other) noexcept{
+  if (this != &other){
+    release();
+    blocks = other.blocks;
+    freeList = other.freeList;
+    nextCapacity = other.nextCapacity;
+    other.blocks = nullptr;
+    other.freeList = nullptr;
+    other.nextCapacity = FIRST_BLOCK_NODES;
+  }
+  return *this;
+}
+
+//Hand out a node: reuse a released one, else take the next slot of the current block
+template <typename VertexT, typename WeightT>
+typename BasicNeighborPool<VertexT, WeightT>::Neighbor* BasicNeighborPool<VertexT, WeightT>::allocate(VertexT vertex, WeightT weight, Neighbor* next){
+  if (freeList != nullptr){
+    Neighbor* node = freeList;
+    freeList = freeList->next;
+    return new (node) Neighbor(vertex, weight, next);
+  }
+  if (blocks == nullptr || blocks->used == blocks->capacity){
+    Block* block = new Block;
+    block->nodes = static_cast<Neighbor*>(::operator new(sizeof(Neighbor) * nextCapacity));
+    block->capacity = nextCapacity;
+    block->used = 0;
+    block->next = blocks;
+    blocks = block;
+    if (nextCapacity < MAX_BLOCK_NODES) nextCapacity *= 2;
+  }
+  return new (&blocks->nodes[blocks->used++]) Neighbor(vertex, weight, next);
+}
+
+//Hand out a run of count nodes in a dedicated block. The block is linked
+//behind the current one so that block keeps serving allocate().
+template <typename VertexT, typename WeightT>
+typename BasicNeighborPool<VertexT, WeightT>::Neighbor* BasicNeighborPool<VertexT, WeightT>::allocateRun(size_t count){
+  Block* block = new Block;
+  block->nodes = static_cast<Neighbor*>(::operator new(sizeof(Neighbor) * (count > 0 ? count : 1)));
+  block->capacity = count;
+  block->used = count;
+  if (blocks == nullptr){
+    block->next = nullptr;
+    blocks = block;
+  } else {
+    block->next = blocks->next;
+    blocks->next = block;
+  }
+  return block->nodes;
+}
+
+//Return a node to the free list; its memory is reclaimed with the arena
+template <typename VertexT, typename WeightT>
+void BasicNeighborPool<VertexT, WeightT>::deallocate(Neighbor* node){
+  node->next = freeList;
+  freeList = node;
+}
+
 //Construct graph with fixed number of vertices
-Graph::Graph(int numVertices) : numVertices(numVertices){ 
+template <typename VertexT, typename WeightT>
+BasicGraph<VertexT, WeightT>::BasicGraph(VertexT numVertices, bool directed) : numVertices(numVertices), directed(directed), index(nullptr){ 
   
   adjList = new Neighbor*[numVertices]; //Memory allocation
-  for (int i = 0; i < numVertices; i++)
+  for (VertexT i = 0; i < numVertices; i++)
   {
     adjList[i] = nullptr; //initialize all vertices to nullptr
   }
 }
 
-//Destructor function to free memory
-Graph::~Graph(){
-  for (int i = 0; i < numVertices; i++){
-    Neighbor* current = adjList[i];
-    while (current != nullptr){
-      Neighbor* temp = current;
-      current = current->next;
-      delete temp; //delete the neighbor
-    }
-  }
+//Destructor function to free memory (the neighbors are freed with the pool)
+template <typename VertexT, typename WeightT>
+BasicGraph<VertexT, WeightT>::~BasicGraph(){
   delete[] adjList; //delete the pointers list
+  delete index;
+}
+
+//Move constructor: take over the lists and the pool of other
+template <typename VertexT, typename WeightT>
+BasicGraph<VertexT, WeightT>::BasicGraph(BasicGraph&& other) noexcept
+    : numVertices(other.numVertices), directed(other.directed), adjList(other.adjList),
+      pool(std::move(other.pool)), index(other.index){
+  other.numVertices = 0;
+  other.adjList = nullptr;
+  other.index = nullptr;
+}
+
+//Move assignment: drop our own lists and take over those of other
+template <typename VertexT, typename WeightT>
+BasicGraph<VertexT, WeightT>& BasicGraph<VertexT, WeightT>::operator=(BasicGraph&& other) noexcept{
+  if (this != &other){
+    delete[] adjList;
+    delete index;
+    numVertices = other.numVertices;
+    directed = other.directed;
+    adjList = other.adjList;
+    pool = std::move(other.pool);
+    index = other.index;
+    other.numVertices = 0;
+    other.adjList = nullptr;
+    other.index = nullptr;
+  }
+  return *this;
 }
 //Function to check vertices index validity
-void Graph::validateVertex(int v) const {
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::validateVertex(VertexT v) const {
     if (v < 0 || v >= numVertices) {
         throw "Invalid vertex index";
     }
 }
-//Function to add an edge between two vertices
-void Graph::addEdge(int source, int dest, int weight){
+//Function to add an edge between two vertices (from source to dest if directed)
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::addEdge(VertexT source, VertexT dest, WeightT weight){
   validateVertex(source);
   validateVertex(dest);
-  Neighbor* newVertex = new Neighbor(dest, weight, adjList[source]);
+  Neighbor* newVertex = pool.allocate(dest, weight, adjList[source]);
         adjList[source] = newVertex; //add the neighbor to the list of the source vertex
     
-        newVertex = new Neighbor(source, weight, adjList[dest]);
+        if (index) indexFront(source);
+        if (directed) return; //out-neighbor only
+    
+        newVertex = pool.allocate(source, weight, adjList[dest]);
         adjList[dest] = newVertex; //add the neighbor to the list of the destination vertex
+        if (index) indexFront(dest);
+}
+
+//Bulk insertion: count degrees, take one run of nodes for all of them and
+//lay every vertex's new neighbors out contiguously. Rows are filled from
+//their end and linked in front of the old list, which is the order that
+//repeated addEdge calls (prepending) would give.
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::addEdges(const Edge* edges, size_t count){
+  for (size_t i = 0; i < count; ++i){ //validate everything before changing the graph
+    validateVertex(edges[i].u);
+    validateVertex(edges[i].v);
+  }
+  if (count == 0) return;
+
+  //First pass: row offsets from the degrees
+  size_t* offsets = new size_t[numVertices + 1]();
+  for (size_t i = 0; i < count; ++i){
+    ++offsets[edges[i].u + 1];
+    if (!directed) ++offsets[edges[i].v + 1];
+  }
+  for (VertexT v = 0; v < numVertices; ++v)
+    offsets[v + 1] += offsets[v];
+
+  //Second pass: fill every row from its end; each node links to the next
+  //slot of its row, and the last one to the old list
+  Neighbor* run = pool.allocateRun(directed ? count : 2 * count);
+  size_t* cursor = new size_t[numVertices];
+  for (VertexT v = 0; v < numVertices; ++v)
+    cursor[v] = offsets[v + 1];
+
+  for (size_t i = 0; i < count; ++i){
+    const Edge& e = edges[i];
+    size_t slot = --cursor[e.u];
+    new (&run[slot]) Neighbor(e.v, e.weight, slot + 1 < offsets[e.u + 1] ? &run[slot + 1] : adjList[e.u]);
+    if (directed) continue;
+    slot = --cursor[e.v];
+    new (&run[slot]) Neighbor(e.u, e.weight, slot + 1 < offsets[e.v + 1] ? &run[slot + 1] : adjList[e.v]);
+  }
+
+  for (VertexT v = 0; v < numVertices; ++v){
+    if (offsets[v] == offsets[v + 1]) continue;
+    adjList[v] = &run[offsets[v]];
+    if (index == nullptr) continue;
+
+    //The old head is now reached through the row's last node
+    Neighbor* oldHead = run[offsets[v + 1] - 1].next;
+    if (oldHead){
+      typename EdgeIndex::Entry* entry = index->find(v, oldHead->vertex);
+      if (entry->link == &adjList[v]) entry->link = &run[offsets[v + 1] - 1].next;
+    }
+    //Index the row from its back, so the front-most copy of a key wins
+    for (size_t slot = offsets[v + 1]; slot-- > offsets[v];){
+      typename EdgeIndex::Entry* entry = index->findOrAdd(v, run[slot].vertex);
+      entry->link = slot == offsets[v] ? &adjList[v] : &run[slot - 1].next;
+      ++entry->count;
+    }
+  }
+  delete[] offsets;
+  delete[] cursor;
 }
 
 //Helper function to remove a vertex v from neighbors list
-void removeNeighbor(Neighbor* &head, int v){
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::removeNeighbor(Neighbor* &head, VertexT v){
   if (head == nullptr) return;
 
   if (head->vertex == v){
     Neighbor* temp = head;
     head = head->next;
-    delete temp;
+    pool.deallocate(temp);
     return;
   }
   Neighbor* current = head;
@@ -61,14 +245,21 @@ void removeNeighbor(Neighbor* &head, int v){
     if (current->next && current->next->vertex == v){
       Neighbor* temp = current->next;
       current->next = temp->next;
-      delete temp;
+      pool.deallocate(temp);
     }
 }
 
 //Method to remove an edge between vertices
-void Graph::removeEdge(int source,int dest){
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::removeEdge(VertexT source, VertexT dest){
   validateVertex(source);
   validateVertex(dest);
+  if (index){
+    if (index->find(source, dest) == nullptr) return; //edge does not exist
+    unlinkIndexed(source, dest);
+    if (!directed) unlinkIndexed(dest, source);
+    return;
+  }
   bool isEdge = false;
   Neighbor* current = adjList[source];
   while (current){ //searching the edge
@@ -81,13 +272,140 @@ void Graph::removeEdge(int source,int dest){
   if (!isEdge) return; //edge does not exist
 
   removeNeighbor(adjList[source], dest); //remove the destination vertex from the source neighbors list
+  if (directed) return;
   removeNeighbor(adjList[dest], source); //removing vertex from the destination neighbors list
 }
 
+//Link pointing at the front-most v node of u's list (nullptr if none)
+template <typename VertexT, typename WeightT>
+typename BasicGraph<VertexT, WeightT>::Neighbor** BasicGraph<VertexT, WeightT>::findLink(VertexT u, VertexT v) const {
+  if (index){
+    typename EdgeIndex::Entry* entry = index->find(u, v);
+    return entry ? entry->link : nullptr;
+  }
+  Neighbor** link = &adjList[u];
+  while (*link && (*link)->vertex != v){
+    link = &(*link)->next;
+  }
+  return *link ? link : nullptr;
+}
+
+//Index the node just pushed to the front of u's list. The old head is now
+//linked from the new node, so its entry moves along if it pointed at the head.
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::indexFront(VertexT u){
+  Neighbor* head = adjList[u];
+  if (head->next){
+    typename EdgeIndex::Entry* entry = index->find(u, head->next->vertex);
+    if (entry->link == &adjList[u]) entry->link = &head->next;
+  }
+  typename EdgeIndex::Entry* entry = index->findOrAdd(u, head->vertex);
+  entry->link = &adjList[u];
+  ++entry->count;
+}
+
+//Unlink the front-most v node of u's list through the index
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::unlinkIndexed(VertexT u, VertexT v){
+  typename EdgeIndex::Entry* entry = index->find(u, v);
+  if (entry == nullptr) return;
+
+  Neighbor** link = entry->link;
+  Neighbor* node = *link;
+  *link = node->next;
+  if (node->next){ //the follower is now reached through link
+    typename EdgeIndex::Entry* follower = index->find(u, node->next->vertex);
+    if (follower->link == &node->next) follower->link = link;
+  }
+
+  if (--entry->count == 0){
+    index->erase(u, v);
+  } else { //a parallel copy further down becomes the front-most one
+    while ((*link)->vertex != v){
+      link = &(*link)->next;
+    }
+    entry->link = link;
+  }
+  pool.deallocate(node);
+}
+
+//Check if the edge src-dest exists
+template <typename VertexT, typename WeightT>
+bool BasicGraph<VertexT, WeightT>::hasEdge(VertexT source, VertexT dest) const {
+  validateVertex(source);
+  validateVertex(dest);
+  return findLink(source, dest) != nullptr;
+}
+
+//Weight of the edge src-dest (the most recently added copy)
+template <typename VertexT, typename WeightT>
+WeightT BasicGraph<VertexT, WeightT>::getWeight(VertexT source, VertexT dest) const {
+  validateVertex(source);
+  validateVertex(dest);
+  Neighbor** link = findLink(source, dest);
+  if (link == nullptr){
+    throw "Edge does not exist";
+  }
+  return (*link)->weight;
+}
+
+//Change the weight of the edge src-dest (in both neighbor lists if undirected)
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::updateWeight(VertexT source, VertexT dest, WeightT weight){
+  validateVertex(source);
+  validateVertex(dest);
+  Neighbor** link = findLink(source, dest);
+  if (link == nullptr){
+    throw "Edge does not exist";
+  }
+  Neighbor* node = *link;
+  node->weight = weight;
+  if (directed) return;
+  if (source == dest){ //a loop has both of its nodes in the same list
+    Neighbor* twin = node->next;
+    while (twin->vertex != source){
+      twin = twin->next;
+    }
+    twin->weight = weight;
+  } else {
+    (*findLink(dest, source))->weight = weight;
+  }
+}
+
+//Build the index from the current lists; the first node of a key in a list is the front-most
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::enableEdgeIndex(){
+  if (index) return;
+  size_t entries = 0;
+  for (VertexT u = 0; u < numVertices; ++u)
+    for (Neighbor* n = adjList[u]; n != nullptr; n = n->next)
+      ++entries;
+  index = new EdgeIndex(entries);
+  for (VertexT u = 0; u < numVertices; ++u){
+    for (Neighbor** link = &adjList[u]; *link != nullptr; link = &(*link)->next){
+      typename EdgeIndex::Entry* entry = index->findOrAdd(u, (*link)->vertex);
+      if (entry->count == 0) entry->link = link;
+      ++entry->count;
+    }
+  }
+}
+
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::disableEdgeIndex(){
+  delete index;
+  index = nullptr;
+}
+
+template <typename VertexT, typename WeightT>
+bool BasicGraph<VertexT, WeightT>::hasEdgeIndex() const {
+  return index != nullptr;
+}
+
 //Graph printing method
-void Graph::printGraph() const {
+template <typename VertexT, typename WeightT>
+void BasicGraph<VertexT, WeightT>::printGraph() const {
   std::cout << "Adjacency List:" << std::endl;
-  for (int i = 0; i < numVertices; ++i) {
+  for (VertexT i = 0; i < numVertices; ++i) {
       std::cout << "  [" << i << "] --> ";
       Neighbor* current = adjList[i];
       if (!current) {
@@ -104,12 +422,104 @@ void Graph::printGraph() const {
 }
 
 //Method that returns the vertices number of the graph
-int Graph::getNumVertices() const {
+template <typename VertexT, typename WeightT>
+VertexT BasicGraph<VertexT, WeightT>::getNumVertices() const {
   return numVertices;
 }
 
+//Method that tells whether edges are one-way
+template <typename VertexT, typename WeightT>
+bool BasicGraph<VertexT, WeightT>::isDirected() const {
+  return directed;
+}
+
+//Reverse every edge with one bulk insertion. The edges are handed over
+//backwards, so (as addEdges prepends) every in-list is sorted by source.
+template <typename VertexT, typename WeightT>
+BasicGraph<VertexT, WeightT> BasicGraph<VertexT, WeightT>::transpose() const {
+  if (!directed){
+    throw "Only directed graphs can be transposed";
+  }
+  size_t count = 0;
+  for (VertexT u = 0; u < numVertices; ++u)
+    for (Neighbor* n = adjList[u]; n != nullptr; n = n->next)
+      ++count;
+
+  Edge* reversed = new Edge[count];
+  size_t i = count;
+  for (VertexT u = 0; u < numVertices; ++u)
+    for (Neighbor* n = adjList[u]; n != nullptr; n = n->next)
+      reversed[--i] = {n->vertex, u, n->weight};
+
+  BasicGraph result(numVertices, true);
+  result.addEdges(reversed, count);
+  delete[] reversed;
+  return result;
+}
+
 //Method to get the neighbor list of a vertex
-Neighbor* Graph::getNeighbors(int vertex) const {
+template <typename VertexT, typename WeightT>
+typename BasicGraph<VertexT, WeightT>::Neighbor* BasicGraph<VertexT, WeightT>::getNeighbors(VertexT vertex) const {
   validateVertex(vertex);
   return adjList[vertex];
 }
+
+//Builder: edges are buffered in a doubling array until build()
+template <typename VertexT, typename WeightT>
+BasicGraphBuilder<VertexT, WeightT>::BasicGraphBuilder(VertexT numVertices, bool directed)
+    : numVertices(numVertices), directed(directed), edges(nullptr), count(0), capacity(0){
+  if (numVertices < 0){
+    throw "Invalid graph size";
+  }
+}
+
+template <typename VertexT, typename WeightT>
+BasicGraphBuilder<VertexT, WeightT>::~BasicGraphBuilder(){
+  delete[] edges;
+}
+
+template <typename VertexT, typename WeightT>
+void BasicGraphBuilder<VertexT, WeightT>::grow(size_t minCapacity){
+  size_t newCapacity = capacity == 0 ? 64 : 2 * capacity;
+  if (newCapacity < minCapacity) newCapacity = minCapacity;
+  Edge* grown = new Edge[newCapacity];
+  for (size_t i = 0; i < count; ++i)
+    grown[i] = edges[i];
+  delete[] edges;
+  edges = grown;
+  capacity = newCapacity;
+}
+
+//Make room for edgeCount edges in total
+template <typename VertexT, typename WeightT>
+void BasicGraphBuilder<VertexT, WeightT>::reserve(size_t edgeCount){
+  if (edgeCount > capacity) grow(edgeCount);
+}
+
+//Queue an edge; vertices are checked now so errors point at the bad call
+template <typename VertexT, typename WeightT>
+void BasicGraphBuilder<VertexT, WeightT>::addEdge(VertexT source, VertexT dest, WeightT weight){
+  if (source < 0 || source >= numVertices || dest < 0 || dest >= numVertices){
+    throw "Invalid vertex index";
+  }
+  if (count == capacity) grow(count + 1);
+  edges[count++] = {source, dest, weight};
+}
+
+template <typename VertexT, typename WeightT>
+size_t BasicGraphBuilder<VertexT, WeightT>::getNumEdges() const {
+  return count;
+}
+
+template <typename VertexT, typename WeightT>
+BasicGraph<VertexT, WeightT> BasicGraphBuilder<VertexT, WeightT>::build() const {
+  BasicGraph<VertexT, WeightT> g(numVertices, directed);
+  g.addEdges(edges, count);
+  return g;
+}
+
+#define GRAPH_INSTANTIATE_GRAPH(V, W)              \
+  template class graph::BasicNeighborPool<V, W>; \
+  template class graph::BasicGraph<V, W>;        \
+  template class graph::BasicGraphBuilder<V, W>;
+GRAPH_FOR_EACH_TYPE_PAIR(GRAPH_INSTANTIATE_GRAPH)
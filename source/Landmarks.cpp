@@ -0,0 +1,341 @@
+// Author: realyoavperetz@gmail.com
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include "../include/Landmarks.hpp"
+#include "../include/Algorithms.hpp"
+#include "../include/Adjacency.hpp"
+
+using namespace graph;
+
+namespace {
+
+const char FILE_MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'A', 'L', 'T'};
+const uint32_t FILE_VERSION = 1;
+const uint32_t FILE_BYTE_ORDER = 0x01020304;
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  int64_t numVertices;
+  int64_t numLandmarks;
+  uint64_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 40, "Landmark file header must be 40 bytes");
+
+// Deterministic root choice for the selection rounds
+int nextRoot(unsigned long long& seed, int n) {
+  seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  return (int)((seed >> 33) % (unsigned long long)n);
+}
+
+/*
+Landmark selection state: chosen[v] marks landmarks, and nearest[v] is the
+distance from v to its closest landmark so far (INT_MAX if none reaches it).
+distances has a row of stride entries per vertex, of which the first
+count are filled.
+*/
+struct Selection {
+  int n;
+  int stride;
+  int count;
+  const int* distances;
+  bool* chosen;
+  int* nearest;
+
+  // Landmark bound on d(v, t) from the landmarks chosen so far
+  int bound(int v, int t) const {
+    int best = 0;
+    for (int i = 0; i < count; ++i) {
+      int dv = distances[(size_t)v * stride + i];
+      int dt = distances[(size_t)t * stride + i];
+      if (dv == INT_MAX || dt == INT_MAX) continue;
+      int b = dv > dt ? dv - dt : dt - dv;
+      if (b > best) best = b;
+    }
+    return best;
+  }
+
+  // Unchosen vertex with the largest nearest[] (unreached vertices first)
+  int farthest() const {
+    int best = -1;
+    for (int v = 0; v < n; ++v)
+      if (!chosen[v] && (best == -1 || nearest[v] > nearest[best]))
+        best = v;
+    return best;
+  }
+};
+
+/*
+Farthest: the first landmark is the vertex farthest from a random root,
+every later one the vertex farthest from all landmarks chosen so far.
+*/
+template <typename G>
+int pickFarthest(const G& g, const Selection& s, unsigned long long& seed) {
+  if (s.count > 0) return s.farthest();
+
+  ShortestPathResult tree = Algorithms::dijkstraDistances(g, nextRoot(seed, s.n));
+  int best = tree.source;
+  for (int v = 0; v < s.n; ++v)
+    if (tree.reachable(v) && tree.dist[v] > tree.dist[best])
+      best = v;
+  return best;
+}
+
+/*
+Avoid (Goldberg and Werneck): grow a shortest path tree from a random
+root and weigh every vertex by how much the current bounds underestimate
+d(root, v). The subtree with the largest total weight that holds no
+landmark is the region the landmarks serve worst; walking down it along
+the heaviest children ends at a leaf, the next landmark.
+*/
+template <typename G>
+int pickAvoid(const G& g, const Selection& s, unsigned long long& seed) {
+  int n = s.n;
+  int root = nextRoot(seed, n);
+  ShortestPathResult tree = Algorithms::dijkstraDistances(g, root);
+
+  //Children of every vertex in the tree, as CSR rows
+  int* childStart = new int[n + 1]();
+  for (int v = 0; v < n; ++v)
+    if (tree.parent[v] != -1) ++childStart[tree.parent[v] + 1];
+  for (int v = 0; v < n; ++v)
+    childStart[v + 1] += childStart[v];
+  int* children = new int[childStart[n]];
+  int* cursor = new int[n];
+  for (int v = 0; v < n; ++v)
+    cursor[v] = childStart[v];
+  for (int v = 0; v < n; ++v)
+    if (tree.parent[v] != -1) children[cursor[tree.parent[v]]++] = v;
+
+  //Preorder of the tree, then subtree sizes bottom-up
+  int* order = cursor; //reused: the cursors are no longer needed
+  int visited = 0;
+  order[visited++] = root;
+  for (int i = 0; i < visited; ++i)
+    for (int c = childStart[order[i]]; c < childStart[order[i] + 1]; ++c)
+      order[visited++] = children[c];
+
+  long long* size = new long long[n]();
+  bool* covered = new bool[n]();
+  for (int i = visited - 1; i >= 0; --i) {
+    int v = order[i];
+    covered[v] = covered[v] || s.chosen[v];
+    if (!covered[v]) size[v] += tree.dist[v] - s.bound(v, root);
+    int p = tree.parent[v];
+    if (p == -1) continue;
+    if (covered[v]) covered[p] = true;
+    else size[p] += size[v];
+  }
+  for (int i = 0; i < visited; ++i)
+    if (covered[order[i]]) size[order[i]] = 0;
+
+  int best = root;
+  for (int i = 0; i < visited; ++i)
+    if (size[order[i]] > size[best]) best = order[i];
+
+  int result = -1;
+  if (size[best] > 0) {
+    while (childStart[best] < childStart[best + 1]) {
+      int next = children[childStart[best]];
+      for (int c = childStart[best] + 1; c < childStart[best + 1]; ++c)
+        if (size[children[c]] > size[next]) next = children[c];
+      best = next;
+    }
+    result = best;
+  }
+
+  delete[] childStart;
+  delete[] children;
+  delete[] order;
+  delete[] size;
+  delete[] covered;
+  //Nothing left uncovered in this tree (e.g. a fully covered component)
+  return result != -1 && !s.chosen[result] ? result : s.farthest();
+}
+
+}
+
+//Choose the landmarks one by one; each one's Dijkstra distances feed the
+//next choice
+template <typename G>
+void LandmarkIndex::build(const G& g, int count, LandmarkSelection selection) {
+  requireUndirected(g);
+  if (count < 0) {
+    throw "Invalid number of landmarks";
+  }
+  int n = g.getNumVertices();
+  if (count > n) count = n;
+
+  numVertices = n;
+  numLandmarks = count;
+  landmarks = new int[count];
+  distances = new int[(size_t)n * count];
+
+  Selection s = {n, count, 0, distances, new bool[n](), new int[n]};
+  for (int v = 0; v < n; ++v)
+    s.nearest[v] = INT_MAX;
+
+  unsigned long long seed = 88172645463325252ULL;
+  try {
+    for (int i = 0; i < count; ++i) {
+      int next = selection == LandmarkSelection::Avoid ? pickAvoid(g, s, seed) : pickFarthest(g, s, seed);
+      ShortestPathResult r = Algorithms::dijkstraDistances(g, next);
+      landmarks[i] = next;
+      s.chosen[next] = true;
+      for (int v = 0; v < n; ++v) {
+        distances[(size_t)v * count + i] = r.dist[v];
+        if (r.dist[v] < s.nearest[v]) s.nearest[v] = r.dist[v];
+      }
+      ++s.count;
+    }
+  } catch (...) {
+    delete[] s.chosen;
+    delete[] s.nearest;
+    delete[] landmarks;
+    delete[] distances;
+    throw;
+  }
+  delete[] s.chosen;
+  delete[] s.nearest;
+}
+
+LandmarkIndex::LandmarkIndex(const Graph& g, int count, LandmarkSelection selection)
+    : numVertices(0), numLandmarks(0), landmarks(nullptr), distances(nullptr) {
+  build(g, count, selection);
+}
+
+LandmarkIndex::LandmarkIndex(const CSRGraph& g, int count, LandmarkSelection selection)
+    : numVertices(0), numLandmarks(0), landmarks(nullptr), distances(nullptr) {
+  build(g, count, selection);
+}
+
+//Read a file written by save(); the whole file is checked before use
+LandmarkIndex::LandmarkIndex(const char* path)
+    : numVertices(0), numLandmarks(0), landmarks(nullptr), distances(nullptr) {
+  std::FILE* file = std::fopen(path, "rb");
+  if (file == nullptr) {
+    throw "Failed to open landmark file";
+  }
+  FileHeader header;
+  const char* error = nullptr;
+  long fileSize = -1;
+  if (std::fseek(file, 0, SEEK_END) == 0) fileSize = std::ftell(file);
+  std::rewind(file);
+
+  if (fileSize < (long)sizeof(header) || std::fread(&header, sizeof(header), 1, file) != 1 ||
+      std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) {
+    error = "Invalid landmark file";
+  } else if (header.version != FILE_VERSION) {
+    error = "Unsupported landmark file version";
+  } else if (header.byteOrder != FILE_BYTE_ORDER) {
+    error = "Landmark file has a different byte order";
+  } else if (header.numVertices < 0 || header.numVertices > INT32_MAX || header.numLandmarks < 0 ||
+             header.numLandmarks > header.numVertices ||
+             (uint64_t)fileSize != sizeof(header) + sizeof(int) * (uint64_t)header.numLandmarks *
+                                                        ((uint64_t)header.numVertices + 1)) {
+    error = "Invalid landmark file";
+  } else {
+    numVertices = (int)header.numVertices;
+    numLandmarks = (int)header.numLandmarks;
+    size_t entries = (size_t)numVertices * numLandmarks;
+    landmarks = new int[numLandmarks];
+    distances = new int[entries];
+    if (std::fread(landmarks, sizeof(int), numLandmarks, file) != (size_t)numLandmarks ||
+        std::fread(distances, sizeof(int), entries, file) != entries) {
+      error = "Invalid landmark file";
+    }
+    for (int i = 0; error == nullptr && i < numLandmarks; ++i)
+      if (landmarks[i] < 0 || landmarks[i] >= numVertices) error = "Invalid landmark file";
+  }
+  std::fclose(file);
+  if (error != nullptr) {
+    delete[] landmarks;
+    delete[] distances;
+    throw error;
+  }
+}
+
+LandmarkIndex::~LandmarkIndex() {
+  delete[] landmarks;
+  delete[] distances;
+}
+
+LandmarkIndex::LandmarkIndex(LandmarkIndex&& other) noexcept
+    : numVertices(other.numVertices), numLandmarks(other.numLandmarks), landmarks(other.landmarks),
+      distances(other.distances) {
+  other.numVertices = 0;
+  other.numLandmarks = 0;
+  other.landmarks = nullptr;
+  other.distances = nullptr;
+}
+
+LandmarkIndex& LandmarkIndex::operator=(LandmarkIndex&& other) noexcept {
+  if (this != &other) {
+    delete[] landmarks;
+    delete[] distances;
+    numVertices = other.numVertices;
+    numLandmarks = other.numLandmarks;
+    landmarks = other.landmarks;
+    distances = other.distances;
+    other.numVertices = 0;
+    other.numLandmarks = 0;
+    other.landmarks = nullptr;
+    other.distances = nullptr;
+  }
+  return *this;
+}
+
+//Write header, landmarks and the distance table
+void LandmarkIndex::save(const char* path) const {
+  std::FILE* file = std::fopen(path, "wb");
+  if (file == nullptr) {
+    throw "Failed to open landmark file";
+  }
+  FileHeader header;
+  std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+  header.version = FILE_VERSION;
+  header.byteOrder = FILE_BYTE_ORDER;
+  header.numVertices = numVertices;
+  header.numLandmarks = numLandmarks;
+  header.reserved = 0;
+  size_t entries = (size_t)numVertices * numLandmarks;
+  bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+            std::fwrite(landmarks, sizeof(int), numLandmarks, file) == (size_t)numLandmarks &&
+            std::fwrite(distances, sizeof(int), entries, file) == entries;
+  if (std::fclose(file) != 0 || !ok) {
+    throw "Failed to write landmark file";
+  }
+}
+
+//Plain A* with this index as the heuristic, after a size check
+template <typename G>
+static PathResult landmarkSearch(const LandmarkIndex& index, const G& g, int source, int target,
+                                 SearchWorkspace& workspace) {
+  if (g.getNumVertices() != index.getNumVertices()) {
+    throw "Landmark index does not match the graph";
+  }
+  return Algorithms::astar(g, source, target, index, workspace);
+}
+
+PathResult LandmarkIndex::shortestPath(const Graph& g, int source, int target) const {
+  SearchWorkspace workspace(g.getNumVertices());
+  return landmarkSearch(*this, g, source, target, workspace);
+}
+
+PathResult LandmarkIndex::shortestPath(const CSRGraph& g, int source, int target) const {
+  SearchWorkspace workspace(g.getNumVertices());
+  return landmarkSearch(*this, g, source, target, workspace);
+}
+
+PathResult LandmarkIndex::shortestPath(const Graph& g, int source, int target, SearchWorkspace& workspace) const {
+  return landmarkSearch(*this, g, source, target, workspace);
+}
+
+PathResult LandmarkIndex::shortestPath(const CSRGraph& g, int source, int target,
+                                       SearchWorkspace& workspace) const {
+  return landmarkSearch(*this, g, source, target, workspace);
+}
@@ -0,0 +1,149 @@
+// Author: realyoavperetz@gmail.com
+
+#include <atomic>
+#include "../include/Parallel.hpp"
+
+using namespace graph;
+
+int graph::resolveThreadCount(int requested) {
+    if (requested > 0) return requested;
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    return cores > 0 ? cores : 1;
+}
+
+Barrier::Barrier(int count) : count(count), waiting(0), generation(0) {}
+
+// The last thread to arrive starts a new round and wakes the others
+void Barrier::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    int round = generation;
+    if (++waiting == count) {
+        waiting = 0;
+        ++generation;
+        released.notify_all();
+        return;
+    }
+    released.wait(lock, [&] { return generation != round; });
+}
+
+namespace {
+
+// Fresh threads for threadIds 1.., used when the pool is busy
+void runOnNewThreads(int numThreads, void (*invoke)(void*, int), void* context) {
+    std::thread* workers = new std::thread[numThreads - 1];
+    for (int t = 1; t < numThreads; ++t)
+        workers[t - 1] = std::thread(invoke, context, t);
+    invoke(context, 0);
+    for (int t = 1; t < numThreads; ++t)
+        workers[t - 1].join();
+    delete[] workers;
+}
+
+/*
+Parked workers for runParallel. Worker i runs threadId i + 1. A job is
+published under the mutex by bumping the job counter; the workers whose
+threadId is below the job's thread count run it and the last one to
+finish wakes the caller. One job runs at a time.
+*/
+class WorkerPool {
+private:
+    std::mutex mutex;
+    std::condition_variable wake;      // a job was published or the pool stops
+    std::condition_variable finished;  // the last worker of a job is done
+    std::thread* workers;
+    int numWorkers;
+    void (*invoke)(void*, int);        // current job
+    void* context;
+    int numThreads;                    // threadIds of the current job
+    int remaining;                     // workers of the current job still running
+    unsigned long long job;            // number of jobs published
+    bool stopping;
+    std::atomic<bool> busy;            // a caller owns the pool
+
+    void workerLoop(int threadId, unsigned long long seen) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wake.wait(lock, [&] { return stopping || job != seen; });
+            if (stopping) return;
+            seen = job;
+            if (threadId >= numThreads) continue;
+            void (*f)(void*, int) = invoke;
+            void* c = context;
+            lock.unlock();
+            f(c, threadId);
+            lock.lock();
+            if (--remaining == 0) finished.notify_one();
+        }
+    }
+
+    // Start workers until threadIds [1, numThreads) are covered; mutex held
+    void grow(int numThreads) {
+        if (numThreads - 1 <= numWorkers) return;
+        std::thread* grown = new std::thread[numThreads - 1];
+        for (int i = 0; i < numWorkers; ++i)
+            grown[i] = std::move(workers[i]);
+        for (int i = numWorkers; i < numThreads - 1; ++i)
+            grown[i] = std::thread(&WorkerPool::workerLoop, this, i + 1, job);
+        delete[] workers;
+        workers = grown;
+        numWorkers = numThreads - 1;
+    }
+
+    // Wait until every worker of the current job is done, then free the pool
+    void waitForWorkers() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [&] { return remaining == 0; });
+        }
+        busy.store(false, std::memory_order_release);
+    }
+
+public:
+    WorkerPool()
+        : workers(nullptr), numWorkers(0), invoke(nullptr), context(nullptr), numThreads(0),
+          remaining(0), job(0), stopping(false), busy(false) {}
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (int i = 0; i < numWorkers; ++i)
+            workers[i].join();
+        delete[] workers;
+    }
+
+    void run(int numThreads, void (*invoke)(void*, int), void* context) {
+        if (busy.exchange(true, std::memory_order_acquire)) {
+            runOnNewThreads(numThreads, invoke, context);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            grow(numThreads);
+            this->invoke = invoke;
+            this->context = context;
+            this->numThreads = numThreads;
+            remaining = numThreads - 1;
+            ++job;
+        }
+        wake.notify_all();
+
+        //threadId 0 may throw; the workers still use the body until they finish
+        try {
+            invoke(context, 0);
+        } catch (...) {
+            waitForWorkers();
+            throw;
+        }
+        waitForWorkers();
+    }
+};
+
+}
+
+void graph::runOnPool(int numThreads, void (*invoke)(void*, int), void* context) {
+    static WorkerPool pool;
+    pool.run(numThreads, invoke, context);
+}
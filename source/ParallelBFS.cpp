@@ -0,0 +1,148 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/Algorithms.hpp"
+#include "../include/Adjacency.hpp"
+#include "../include/Parallel.hpp"
+#include <atomic>
+
+using namespace graph;
+
+// Frontier vertices handed to a thread at a time
+static const int FRONTIER_CHUNK = 64;
+// Discovered vertices buffered per thread before publishing them
+static const int LOCAL_BUFFER = 256;
+
+/*
+Level-synchronous parallel BFS:
+all threads expand the current level together, grabbing chunks of the
+frontier from a shared cursor. A vertex is claimed by the single thread
+whose compare-and-swap sets its parent, so every vertex is discovered
+exactly once. Each thread collects its discoveries in a local buffer and
+appends them to the next level with one fetch_add per buffer.
+
+As in the sequential BFS, the visiting order is the queue: level d lives
+in order[levelStart, levelEnd) and the next level is appended behind it.
+Two barriers separate the levels: one after expansion, one after thread 0
+has advanced the level bounds.
+*/
+template <typename G>
+void parallelBfsCore(const G& g, int source, int numThreads,
+                     TraversalResult& result, int* parentWeight) {
+    int n = g.getNumVertices();
+    int* order = result.order;
+    int* depth = result.depth;
+
+    std::atomic<int>* parent = new std::atomic<int>[n];
+    for (int v = 0; v < n; ++v)
+        parent[v].store(-1, std::memory_order_relaxed);
+
+    // The source claims itself so nobody else can
+    parent[source].store(source, std::memory_order_relaxed);
+    depth[source] = 0;
+    order[0] = source;
+
+    std::atomic<int> tail(1);     // end of the discovered prefix of order
+    std::atomic<int> cursor(0);   // next frontier index to hand out
+    int levelStart = 0;
+    int levelEnd = 1;
+    int level = 0;
+    Barrier barrier(numThreads);
+
+    runParallel(numThreads, [&](int threadId) {
+        int local[LOCAL_BUFFER];
+        int localCount = 0;
+
+        auto flush = [&]() {
+            int at = tail.fetch_add(localCount, std::memory_order_relaxed);
+            for (int i = 0; i < localCount; ++i)
+                order[at + i] = local[i];
+            localCount = 0;
+        };
+
+        while (levelStart < levelEnd) {
+            int nextDepth = level + 1;
+            int begin;
+            while ((begin = cursor.fetch_add(FRONTIER_CHUNK, std::memory_order_relaxed)) < levelEnd) {
+                int end = begin + FRONTIER_CHUNK < levelEnd ? begin + FRONTIER_CHUNK : levelEnd;
+                for (int i = begin; i < end; ++i) {
+                    int u = order[i];
+                    for (auto it = neighbors(g, u); it.valid(); it.next()) {
+                        int v = it.vertex();
+                        if (parent[v].load(std::memory_order_relaxed) != -1) continue;
+
+                        int unclaimed = -1;
+                        if (parent[v].compare_exchange_strong(unclaimed, u, std::memory_order_relaxed)) {
+                            depth[v] = nextDepth;
+                            parentWeight[v] = it.weight();
+                            local[localCount++] = v;
+                            if (localCount == LOCAL_BUFFER) flush();
+                        }
+                    }
+                }
+            }
+            if (localCount > 0) flush();
+
+            barrier.wait();
+            if (threadId == 0) {
+                levelStart = levelEnd;
+                levelEnd = tail.load(std::memory_order_relaxed);
+                cursor.store(levelStart, std::memory_order_relaxed);
+                ++level;
+            }
+            barrier.wait();
+        }
+    });
+
+    result.visitedCount = levelEnd;
+    for (int v = 0; v < n; ++v)
+        result.parent[v] = parent[v].load(std::memory_order_relaxed);
+    result.parent[source] = -1;
+
+    delete[] parent;
+}
+
+template <typename G>
+TraversalResult parallelBfsTraversalImpl(const G& g, int source, int numThreads) {
+    g.validateVertex(source);
+    int n = g.getNumVertices();
+    TraversalResult result(n, source);
+    int* parentWeight = new int[n];
+    parallelBfsCore(g, source, resolveThreadCount(numThreads), result, parentWeight);
+    delete[] parentWeight;
+    return result;
+}
+
+template <typename G>
+Graph parallelBfsImpl(const G& g, int source, int numThreads) {
+    g.validateVertex(source);
+    int n = g.getNumVertices();
+    TraversalResult result(n, source);
+    int* parentWeight = new int[n];
+    parallelBfsCore(g, source, resolveThreadCount(numThreads), result, parentWeight);
+
+    // Tree edges in visiting (level) order
+    Graph tree(n, g.isDirected());
+    for (int i = 1; i < result.visitedCount; ++i) {
+        int v = result.order[i];
+        tree.addEdge(result.parent[v], v, parentWeight[v]);
+    }
+
+    delete[] parentWeight;
+    return tree;
+}
+
+Graph Algorithms::parallelBfs(const Graph& g, int source, int numThreads) {
+    return parallelBfsImpl(g, source, numThreads);
+}
+
+Graph Algorithms::parallelBfs(const CSRGraph& g, int source, int numThreads) {
+    return parallelBfsImpl(g, source, numThreads);
+}
+
+TraversalResult Algorithms::parallelBfsTraversal(const Graph& g, int source, int numThreads) {
+    return parallelBfsTraversalImpl(g, source, numThreads);
+}
+
+TraversalResult Algorithms::parallelBfsTraversal(const CSRGraph& g, int source, int numThreads) {
+    return parallelBfsTraversalImpl(g, source, numThreads);
+}
@@ -10,20 +10,18 @@ PriorityQueue::PriorityQueue(int cap) {
     capacity = cap;
     size = 0;
 
+    // Heap slots are written before they are read; only the position map
+    // needs a value, and zero ("not in the heap") comes from value-initialization
     vertices = new int[cap];
     distances = new int[cap];
-
-    // Initialize arrays with default values
-    for (int i = 0; i < cap; ++i) {
-        vertices[i] = -1; // no vertex
-        distances[i] = std::numeric_limits<int>::max(); // infinite distance
-    }
+    position = new int[cap]();
 }
 
 // Destructor: free allocated arrays
 PriorityQueue::~PriorityQueue() {
     delete[] vertices;
     delete[] distances;
+    delete[] position;
 }
 
 // Check if the heap is empty
@@ -39,6 +37,8 @@ void PriorityQueue::swap(int i, int j) {
     distances[i] = distances[j];
     vertices[j] = tempV;
     distances[j] = tempD;
+    position[vertices[i]] = i + 1;
+    position[vertices[j]] = j + 1;
 }
 
 // Restore heap order from a node upward
@@ -54,25 +54,32 @@ void PriorityQueue::heapifyUp(int index) {
 
 // Restore heap order from a node downward
 void PriorityQueue::heapifyDown(int index) {
-    int left = 2 * index + 1;
-    int right = 2 * index + 2;
-    int smallest = index;
+    while (true) {
+        int left = 2 * index + 1;
+        int right = 2 * index + 2;
+        int smallest = index;
 
-    if (left < size && distances[left] < distances[smallest])
-        smallest = left;
-    if (right < size && distances[right] < distances[smallest])
-        smallest = right;
+        if (left < size && distances[left] < distances[smallest])
+            smallest = left;
+        if (right < size && distances[right] < distances[smallest])
+            smallest = right;
 
-    if (smallest != index) {
+        if (smallest == index) break;
         swap(index, smallest);
-        heapifyDown(smallest); // recursive fix
+        index = smallest;
     }
 }
 
 // Insert new (vertex, distance) into heap
 void PriorityQueue::insert(int vertex, int distance) {
+    if (vertex < 0 || vertex >= capacity)
+        throw "Vertex out of range";
+    if (position[vertex] != 0)
+        throw "Vertex already in heap";
+
     vertices[size] = vertex;
     distances[size] = distance;
+    position[vertex] = size + 1;
     heapifyUp(size);
     ++size;
 }
@@ -83,37 +90,55 @@ int PriorityQueue::extractMin() {
         throw "Heap is empty";
 
     int minVertex = vertices[0];
+    position[minVertex] = 0;
 
     // Move last element to root and fix heap
     --size;
-    vertices[0] = vertices[size];
-    distances[0] = distances[size];
-    heapifyDown(0);
+    if (size > 0) {
+        vertices[0] = vertices[size];
+        distances[0] = distances[size];
+        position[vertices[0]] = 1;
+        heapifyDown(0);
+    }
 
     return minVertex;
 }
 
+// Return the distance at the root of the heap
+int PriorityQueue::minDistance() const {
+    if (isEmpty())
+        throw "Heap is empty";
+    return distances[0];
+}
+
 // Return true if vertex exists in the queue
 bool PriorityQueue::contains(int vertex) const {
-    for (int i = 0; i < size; ++i)
-        if (vertices[i] == vertex) return true;
-    return false;
+    return vertex >= 0 && vertex < capacity && position[vertex] != 0;
 }
 
 // Return the stored distance of a vertex
 int PriorityQueue::getDistance(int vertex) const {
-    for (int i = 0; i < size; ++i)
-        if (vertices[i] == vertex) return distances[i];
-    return std::numeric_limits<int>::max(); // default "infinite"
+    if (!contains(vertex))
+        return std::numeric_limits<int>::max(); // default "infinite"
+    return distances[position[vertex] - 1];
 }
 
 // Update distance of a vertex already in the queue
 void PriorityQueue::updateDistance(int vertex, int newDist) {
-    for (int i = 0; i < size; ++i) {
-        if (vertices[i] == vertex) {
-            distances[i] = newDist;
-            heapifyUp(i); // re-balance
-            break;
-        }
-    }
-}
\ No newline at end of file
+    if (!contains(vertex)) return;
+
+    int i = position[vertex] - 1;
+    int oldDist = distances[i];
+    distances[i] = newDist;
+    if (newDist < oldDist)
+        heapifyUp(i);   // decrease-key: move toward the root
+    else
+        heapifyDown(i); // increase-key: move toward the leaves
+}
+
+// Reset the positions of the queued vertices only
+void PriorityQueue::clear() {
+    for (int i = 0; i < size; ++i)
+        position[vertices[i]] = 0;
+    size = 0;
+}
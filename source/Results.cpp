@@ -0,0 +1,248 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/Results.hpp"
+#include <limits>
+
+using namespace graph;
+
+// ----------------------------------------------------------
+// BasicShortestPathResult
+// ----------------------------------------------------------
+
+// Every vertex starts unreachable
+template <typename VertexT, typename DistanceT>
+BasicShortestPathResult<VertexT, DistanceT>::BasicShortestPathResult(VertexT numVertices, VertexT source)
+    : numVertices(numVertices), source(source) {
+    dist = new DistanceT[numVertices];
+    parent = new VertexT[numVertices];
+    for (VertexT i = 0; i < numVertices; ++i) {
+        dist[i] = std::numeric_limits<DistanceT>::max();
+        parent[i] = -1;
+    }
+}
+
+template <typename VertexT, typename DistanceT>
+BasicShortestPathResult<VertexT, DistanceT>::~BasicShortestPathResult() {
+    delete[] dist;
+    delete[] parent;
+}
+
+template <typename VertexT, typename DistanceT>
+BasicShortestPathResult<VertexT, DistanceT>::BasicShortestPathResult(BasicShortestPathResult&& other) noexcept
+    : numVertices(other.numVertices), source(other.source), dist(other.dist), parent(other.parent) {
+    other.numVertices = 0;
+    other.dist = nullptr;
+    other.parent = nullptr;
+}
+
+template <typename VertexT, typename DistanceT>
+BasicShortestPathResult<VertexT, DistanceT>& BasicShortestPathResult<VertexT, DistanceT>::operator=(BasicShortestPathResult&& other) noexcept {
+    if (this != &other) {
+        delete[] dist;
+        delete[] parent;
+        numVertices = other.numVertices;
+        source = other.source;
+        dist = other.dist;
+        parent = other.parent;
+        other.numVertices = 0;
+        other.dist = nullptr;
+        other.parent = nullptr;
+    }
+    return *this;
+}
+
+// True if v has a finite distance from the source
+template <typename VertexT, typename DistanceT>
+bool BasicShortestPathResult<VertexT, DistanceT>::reachable(VertexT v) const {
+    return dist[v] != std::numeric_limits<DistanceT>::max();
+}
+
+// ----------------------------------------------------------
+// BasicTraversalResult
+// ----------------------------------------------------------
+
+// Nothing is visited yet
+template <typename VertexT>
+BasicTraversalResult<VertexT>::BasicTraversalResult(VertexT numVertices, VertexT source)
+    : numVertices(numVertices), source(source), visitedCount(0),
+      discovery(nullptr), finish(nullptr) {
+    order = new VertexT[numVertices];
+    parent = new VertexT[numVertices];
+    depth = new VertexT[numVertices];
+    for (VertexT i = 0; i < numVertices; ++i) {
+        parent[i] = -1;
+        depth[i] = -1;
+    }
+}
+
+template <typename VertexT>
+BasicTraversalResult<VertexT>::~BasicTraversalResult() {
+    delete[] order;
+    delete[] parent;
+    delete[] depth;
+    delete[] discovery;
+    delete[] finish;
+}
+
+template <typename VertexT>
+BasicTraversalResult<VertexT>::BasicTraversalResult(BasicTraversalResult&& other) noexcept
+    : numVertices(other.numVertices), source(other.source), visitedCount(other.visitedCount),
+      order(other.order), parent(other.parent), depth(other.depth),
+      discovery(other.discovery), finish(other.finish) {
+    other.numVertices = 0;
+    other.visitedCount = 0;
+    other.order = nullptr;
+    other.parent = nullptr;
+    other.depth = nullptr;
+    other.discovery = nullptr;
+    other.finish = nullptr;
+}
+
+template <typename VertexT>
+BasicTraversalResult<VertexT>& BasicTraversalResult<VertexT>::operator=(BasicTraversalResult&& other) noexcept {
+    if (this != &other) {
+        delete[] order;
+        delete[] parent;
+        delete[] depth;
+        delete[] discovery;
+        delete[] finish;
+        numVertices = other.numVertices;
+        source = other.source;
+        visitedCount = other.visitedCount;
+        order = other.order;
+        parent = other.parent;
+        depth = other.depth;
+        discovery = other.discovery;
+        finish = other.finish;
+        other.numVertices = 0;
+        other.visitedCount = 0;
+        other.order = nullptr;
+        other.parent = nullptr;
+        other.depth = nullptr;
+        other.discovery = nullptr;
+        other.finish = nullptr;
+    }
+    return *this;
+}
+
+// True if the traversal reached v
+template <typename VertexT>
+bool BasicTraversalResult<VertexT>::visited(VertexT v) const {
+    return depth[v] != -1;
+}
+
+// True if discovery/finish times were recorded
+template <typename VertexT>
+bool BasicTraversalResult<VertexT>::hasTimestamps() const {
+    return discovery != nullptr;
+}
+
+// Allocate the DFS timestamp arrays (no-op if already present)
+template <typename VertexT>
+void BasicTraversalResult<VertexT>::enableTimestamps() {
+    if (discovery != nullptr) return;
+    discovery = new VertexT[numVertices];
+    finish = new VertexT[numVertices];
+    for (VertexT i = 0; i < numVertices; ++i) {
+        discovery[i] = -1;
+        finish[i] = -1;
+    }
+}
+
+// ----------------------------------------------------------
+// BasicPathResult
+// ----------------------------------------------------------
+
+// No path until tracePath is called
+template <typename VertexT, typename DistanceT>
+BasicPathResult<VertexT, DistanceT>::BasicPathResult(VertexT source, VertexT target)
+    : source(source), target(target), cost(std::numeric_limits<DistanceT>::max()),
+      length(0), path(nullptr), settled(0), settledBackward(0) {}
+
+template <typename VertexT, typename DistanceT>
+BasicPathResult<VertexT, DistanceT>::~BasicPathResult() {
+    delete[] path;
+}
+
+template <typename VertexT, typename DistanceT>
+BasicPathResult<VertexT, DistanceT>::BasicPathResult(BasicPathResult&& other) noexcept
+    : source(other.source), target(other.target), cost(other.cost), length(other.length),
+      path(other.path), settled(other.settled), settledBackward(other.settledBackward) {
+    other.length = 0;
+    other.path = nullptr;
+}
+
+template <typename VertexT, typename DistanceT>
+BasicPathResult<VertexT, DistanceT>& BasicPathResult<VertexT, DistanceT>::operator=(BasicPathResult&& other) noexcept {
+    if (this != &other) {
+        delete[] path;
+        source = other.source;
+        target = other.target;
+        cost = other.cost;
+        length = other.length;
+        path = other.path;
+        settled = other.settled;
+        settledBackward = other.settledBackward;
+        other.length = 0;
+        other.path = nullptr;
+    }
+    return *this;
+}
+
+// True if the search reached the target
+template <typename VertexT, typename DistanceT>
+bool BasicPathResult<VertexT, DistanceT>::found() const {
+    return path != nullptr;
+}
+
+// Count the vertices from target back to source, then fill path backwards
+template <typename VertexT, typename DistanceT>
+void BasicPathResult<VertexT, DistanceT>::tracePath(const VertexT* parent, DistanceT pathCost) {
+    delete[] path;
+    length = 1;
+    for (VertexT v = target; v != source; v = parent[v])
+        ++length;
+    path = new VertexT[length];
+    VertexT i = length;
+    for (VertexT v = target; v != source; v = parent[v])
+        path[--i] = v;
+    path[0] = source;
+    cost = pathCost;
+}
+
+// Count both halves of the path, then fill it around meet
+template <typename VertexT, typename DistanceT>
+void BasicPathResult<VertexT, DistanceT>::tracePath(const VertexT* parent, VertexT meet,
+                                                    const VertexT* backwardParent, DistanceT pathCost) {
+    delete[] path;
+    VertexT before = 0; // vertices before meet
+    for (VertexT v = meet; v != source; v = parent[v])
+        ++before;
+    length = before + 1;
+    for (VertexT v = meet; v != target; v = backwardParent[v])
+        ++length;
+    path = new VertexT[length];
+    VertexT i = before;
+    for (VertexT v = meet; v != source; v = parent[v])
+        path[i--] = v;
+    path[0] = source;
+    i = before;
+    for (VertexT v = meet; v != target; v = backwardParent[v])
+        path[++i] = backwardParent[v];
+    cost = pathCost;
+}
+
+// Result types of the vertex/weight pairs in GRAPH_FOR_EACH_TYPE_PAIR
+// (distances of small integer weights are int, long long with 64-bit ids)
+template struct graph::BasicTraversalResult<int>;
+template struct graph::BasicTraversalResult<long long>;
+template struct graph::BasicShortestPathResult<int, int>;
+template struct graph::BasicShortestPathResult<int, float>;
+template struct graph::BasicShortestPathResult<int, double>;
+template struct graph::BasicShortestPathResult<long long, long long>;
+template struct graph::BasicShortestPathResult<long long, double>;
+template struct graph::BasicPathResult<int, int>;
+template struct graph::BasicPathResult<int, float>;
+template struct graph::BasicPathResult<int, double>;
+template struct graph::BasicPathResult<long long, long long>;
+template struct graph::BasicPathResult<long long, double>;
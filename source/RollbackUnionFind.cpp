@@ -0,0 +1,81 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/RollbackUnionFind.hpp"
+
+using namespace graph;
+
+// Constructor: every node is its own root. At most size - 1 unites can
+// succeed without a rollback in between, which bounds the undo stack.
+RollbackUnionFind::RollbackUnionFind(int size) : historySize(0), size(size), sets(size) {
+    parent = new int[size];
+    rank = new int[size];
+    history = new Change[size > 0 ? size - 1 : 0];
+
+    for (int i = 0; i < size; ++i) {
+        parent[i] = i;
+        rank[i] = 0;
+    }
+}
+
+// Destructor: free allocated memory
+RollbackUnionFind::~RollbackUnionFind() {
+    delete[] parent;
+    delete[] rank;
+    delete[] history;
+}
+
+// Walk up to the root
+int RollbackUnionFind::find(int x) const {
+    while (parent[x] != x)
+        x = parent[x];
+    return x;
+}
+
+// Union by rank, recording what changed
+bool RollbackUnionFind::unite(int x, int y) {
+    int rootX = find(x);
+    int rootY = find(y);
+
+    if (rootX == rootY) return false;  // already connected
+
+    if (rank[rootX] < rank[rootY]) {
+        int temp = rootX;
+        rootX = rootY;
+        rootY = temp;
+    }
+
+    bool grew = rank[rootX] == rank[rootY];
+    parent[rootY] = rootX;
+    if (grew) rank[rootX]++;
+    history[historySize++] = {rootY, rootX, grew};
+    --sets;
+    return true;
+}
+
+// Check if x and y are in the same set
+bool RollbackUnionFind::connected(int x, int y) const {
+    return find(x) == find(y);
+}
+
+// Number of disjoint sets left
+int RollbackUnionFind::numSets() const {
+    return sets;
+}
+
+// The state is identified by the undo stack height
+int RollbackUnionFind::snapshot() const {
+    return historySize;
+}
+
+// Pop and revert changes until the stack is back at mark
+void RollbackUnionFind::rollback(int mark) {
+    if (mark < 0 || mark > historySize)
+        throw "Invalid rollback mark";
+
+    while (historySize > mark) {
+        const Change& c = history[--historySize];
+        parent[c.child] = c.child;
+        if (c.rankGrew) rank[c.root]--;
+        ++sets;
+    }
+}
@@ -0,0 +1,220 @@
+// Author: realyoavperetz@gmail.com
+
+#include "../include/Algorithms.hpp"
+#include "../include/AStar.hpp"
+#include "../include/Adjacency.hpp"
+#include "../include/PriorityQueue.hpp"
+#include "../include/DaryPriorityQueue.hpp"
+#include <limits>
+
+using namespace graph;
+
+template <typename G>
+using PathOf = BasicPathResult<typename G::VertexType, typename G::DistanceType>;
+
+// Point-to-point Dijkstra is A* with a zero estimate: the heap starts
+// with the source only and the search ends when target is extracted
+template <typename G, typename PQ>
+PathOf<G> shortestPathImpl(const G& g, typename G::VertexType source, typename G::VertexType target,
+                           BasicSearchWorkspace<typename G::VertexType, typename G::DistanceType, PQ>& workspace) {
+    return astarSearch(g, source, target, workspace, ZeroHeuristic());
+}
+
+PathResult Algorithms::shortestPath(const Graph& g, int source, int target) {
+    SearchWorkspace workspace(g.getNumVertices());
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+PathResult Algorithms::shortestPath(const CSRGraph& g, int source, int target) {
+    SearchWorkspace workspace(g.getNumVertices());
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+PathResult Algorithms::shortestPath(const Graph& g, int source, int target, SearchWorkspace& workspace) {
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+PathResult Algorithms::shortestPath(const CSRGraph& g, int source, int target, SearchWorkspace& workspace) {
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+template <typename V, typename W>
+BasicPathResult<V, typename BasicGraph<V, W>::DistanceType>
+Algorithms::shortestPath(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source,
+                         typename NonDeduced<V>::type target) {
+    BasicSearchWorkspace<V, typename BasicGraph<V, W>::DistanceType> workspace(g.getNumVertices());
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+template <typename V, typename W>
+BasicPathResult<V, typename BasicGraph<V, W>::DistanceType>
+Algorithms::shortestPath(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source,
+                         typename NonDeduced<V>::type target,
+                         BasicSearchWorkspace<V, typename BasicGraph<V, W>::DistanceType>& workspace) {
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+/*
+One side of a bidirectional search: a workspace holding its distances,
+parents and heap, and the number of vertices it settled. A vertex leaves
+the heap settled for good, as with non-negative weights no later
+relaxation can improve it.
+*/
+template <typename G, typename PQ>
+struct SearchSide {
+    typedef typename G::VertexType V;
+    typedef typename G::DistanceType D;
+
+    BasicSearchWorkspace<V, D, PQ>& workspace;
+    PQ& pq;
+    V settledCount;
+
+    SearchSide(BasicSearchWorkspace<V, D, PQ>& workspace, V root)
+        : workspace(workspace), pq(workspace.queue()), settledCount(0) {
+        workspace.reset();
+        workspace.reach(root, 0, -1);
+        pq.insert(root, 0);
+    }
+};
+
+// Settle the closest vertex of side and relax its edges. Every vertex the
+// other side has reached closes a candidate path; best/meet keep the shortest.
+template <typename G, typename PQ>
+void bidirectionalStep(const G& g, SearchSide<G, PQ>& side, const SearchSide<G, PQ>& other,
+                       typename G::DistanceType& best, typename G::VertexType& meet) {
+    typedef typename G::VertexType V;
+    typedef typename G::DistanceType D;
+    const D infinity = std::numeric_limits<D>::max();
+
+    V u = side.pq.extractMin();
+    ++side.settledCount;
+    D distU = side.workspace.distance(u);
+    D otherU = other.workspace.distance(u);
+    if (otherU != infinity && distU + otherU < best) {
+        best = distU + otherU;
+        meet = u;
+    }
+
+    for (auto it = neighbors(g, u); it.valid(); it.next()) {
+        V v = it.vertex();
+        D weight = it.weight();
+        if (weight < 0)
+            throw "Graph contains a negative weight edge – Dijkstra is not allowed";
+
+        D distV = side.workspace.distance(v);
+        if (distU + weight < distV) {
+            distV = distU + weight;
+            side.workspace.reach(v, distV, u);
+            if (side.pq.contains(v))
+                side.pq.updateDistance(v, distV);
+            else
+                side.pq.insert(v, distV);
+        }
+        D otherV = other.workspace.distance(v);
+        if (otherV != infinity && distV + otherV < best) {
+            best = distV + otherV;
+            meet = v;
+        }
+    }
+}
+
+/*
+Bidirectional Dijkstra:
+a forward search from source and a backward search from target (the same
+search, as the graph is undirected) take turns; the side whose next
+vertex is closer goes next. best is the shortest source-target path seen
+so far through a vertex both sides reached. Once the two heap minimums
+add up to at least best, no undiscovered path can be shorter.
+*/
+template <typename G, typename PQ>
+PathOf<G> bidirectionalImpl(const G& g, typename G::VertexType source, typename G::VertexType target,
+                            BasicSearchWorkspace<typename G::VertexType, typename G::DistanceType, PQ>& forwardSpace,
+                            BasicSearchWorkspace<typename G::VertexType, typename G::DistanceType, PQ>& backwardSpace) {
+    typedef typename G::VertexType V;
+    typedef typename G::DistanceType D;
+    requireUndirected(g);
+    g.validateVertex(source);
+    g.validateVertex(target);
+    if (&forwardSpace == &backwardSpace) {
+        throw "Bidirectional search needs two workspaces";
+    }
+    if (forwardSpace.getNumVertices() < g.getNumVertices() || backwardSpace.getNumVertices() < g.getNumVertices()) {
+        throw "Workspace is too small for the graph";
+    }
+
+    PathOf<G> result(source, target);
+    SearchSide<G, PQ> forward(forwardSpace, source);
+    SearchSide<G, PQ> backward(backwardSpace, target);
+    D best = std::numeric_limits<D>::max();
+    V meet = -1;
+
+    while (!forward.pq.isEmpty() && !backward.pq.isEmpty()) {
+        D forwardMin = forward.pq.minDistance();
+        D backwardMin = backward.pq.minDistance();
+        if (meet != -1 && forwardMin + backwardMin >= best) break;
+        if (forwardMin <= backwardMin)
+            bidirectionalStep(g, forward, backward, best, meet);
+        else
+            bidirectionalStep(g, backward, forward, best, meet);
+    }
+
+    if (meet != -1)
+        result.tracePath(forwardSpace.parents(), meet, backwardSpace.parents(), best);
+    result.settled = forward.settledCount;
+    result.settledBackward = backward.settledCount;
+    return result;
+}
+
+PathResult Algorithms::bidirectionalDijkstra(const Graph& g, int source, int target) {
+    SearchWorkspace forward(g.getNumVertices()), backward(g.getNumVertices());
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+PathResult Algorithms::bidirectionalDijkstra(const CSRGraph& g, int source, int target) {
+    SearchWorkspace forward(g.getNumVertices()), backward(g.getNumVertices());
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+PathResult Algorithms::bidirectionalDijkstra(const Graph& g, int source, int target, SearchWorkspace& forward,
+                                             SearchWorkspace& backward) {
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+PathResult Algorithms::bidirectionalDijkstra(const CSRGraph& g, int source, int target, SearchWorkspace& forward,
+                                             SearchWorkspace& backward) {
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+template <typename V, typename W>
+BasicPathResult<V, typename BasicGraph<V, W>::DistanceType>
+Algorithms::bidirectionalDijkstra(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source,
+                                  typename NonDeduced<V>::type target) {
+    BasicSearchWorkspace<V, typename BasicGraph<V, W>::DistanceType> forward(g.getNumVertices());
+    BasicSearchWorkspace<V, typename BasicGraph<V, W>::DistanceType> backward(g.getNumVertices());
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+template <typename V, typename W>
+BasicPathResult<V, typename BasicGraph<V, W>::DistanceType>
+Algorithms::bidirectionalDijkstra(const BasicGraph<V, W>& g, typename NonDeduced<V>::type source,
+                                  typename NonDeduced<V>::type target,
+                                  BasicSearchWorkspace<V, typename BasicGraph<V, W>::DistanceType>& forward,
+                                  BasicSearchWorkspace<V, typename BasicGraph<V, W>::DistanceType>& backward) {
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+#define GRAPH_INSTANTIATE_SHORTEST_PATH(V, W)                                   \
+    template BasicPathResult<V, BasicGraph<V, W>::DistanceType>                 \
+    Algorithms::shortestPath<V, W>(const BasicGraph<V, W>&, V, V);              \
+    template BasicPathResult<V, BasicGraph<V, W>::DistanceType>                 \
+    Algorithms::shortestPath<V, W>(const BasicGraph<V, W>&, V, V,               \
+        BasicSearchWorkspace<V, BasicGraph<V, W>::DistanceType>&);              \
+    template BasicPathResult<V, BasicGraph<V, W>::DistanceType>                 \
+    Algorithms::bidirectionalDijkstra<V, W>(const BasicGraph<V, W>&, V, V);     \
+    template BasicPathResult<V, BasicGraph<V, W>::DistanceType>                 \
+    Algorithms::bidirectionalDijkstra<V, W>(const BasicGraph<V, W>&, V, V,      \
+        BasicSearchWorkspace<V, BasicGraph<V, W>::DistanceType>&,               \
+        BasicSearchWorkspace<V, BasicGraph<V, W>::DistanceType>&);
+
+GRAPH_FOR_EACH_TYPE_PAIR(GRAPH_INSTANTIATE_SHORTEST_PATH)
+#undef GRAPH_INSTANTIATE_SHORTEST_PATH
@@ -5,50 +5,67 @@
 using namespace graph;
 
 // Constructor: initialize each element to be its own parent
-UnionFind::UnionFind(int size) {
-    this->size = size;
-    parent = new int[size];
-    rank = new int[size];
+UnionFind::UnionFind(int size, Strategy strategy) : size(size), sets(size), strategy(strategy) {
+    nodes = new Node[size];
 
     for (int i = 0; i < size; ++i) {
-        parent[i] = i;  // initially, each node is its own root
-        rank[i] = 0;    // all trees start with depth 0
+        nodes[i].parent = i;  // initially, each node is its own root
+        // trees start with rank 0, sets with one element
+        nodes[i].weight = strategy == Strategy::BySize ? 1 : 0;
     }
 }
 
 // Destructor: free allocated memory
 UnionFind::~UnionFind() {
-    delete[] parent;
-    delete[] rank;
+    delete[] nodes;
 }
 
-// Find the root of x, with path compression optimization
+// Find the root of x without recursion. Path halving: every other node on
+// the path is pointed at its grandparent, which halves the path each time.
 int UnionFind::find(int x) {
-    if (parent[x] != x) {
-        parent[x] = find(parent[x]);  // flatten the tree
+    while (nodes[x].parent != x) {
+        nodes[x].parent = nodes[nodes[x].parent].parent;
+        x = nodes[x].parent;
     }
-    return parent[x];
+    return x;
 }
 
-// Union the sets of x and y by rank (attach smaller tree under larger)
+// Union the sets of x and y (attach the lighter root under the heavier one)
 void UnionFind::unite(int x, int y) {
     int rootX = find(x);
     int rootY = find(y);
 
     if (rootX == rootY) return;  // already connected
 
-    // attach smaller tree under larger tree
-    if (rank[rootX] < rank[rootY]) {
-        parent[rootX] = rootY;
-    } else if (rank[rootX] > rank[rootY]) {
-        parent[rootY] = rootX;
-    } else {
-        parent[rootY] = rootX;
-        rank[rootX]++;
+    if (nodes[rootX].weight < nodes[rootY].weight) {
+        int temp = rootX;
+        rootX = rootY;
+        rootY = temp;
     }
+
+    // rootX is now the heavier root
+    nodes[rootY].parent = rootX;
+    if (strategy == Strategy::BySize) {
+        nodes[rootX].weight += nodes[rootY].weight;
+    } else if (nodes[rootX].weight == nodes[rootY].weight) {
+        nodes[rootX].weight++;
+    }
+    --sets;
 }
 
 // Check if x and y are in the same set
 bool UnionFind::connected(int x, int y) {
     return find(x) == find(y);
-}
\ No newline at end of file
+}
+
+// Size of the set containing x, kept at its root
+int UnionFind::setSize(int x) {
+    if (strategy != Strategy::BySize)
+        throw "Set sizes are only tracked with union by size";
+    return nodes[find(x)].weight;
+}
+
+// Number of disjoint sets left
+int UnionFind::numSets() const {
+    return sets;
+}
@@ -7,8 +7,25 @@
 #include "../include/Graph.hpp"
 #include "../include/Queue.hpp"
 #include "../include/PriorityQueue.hpp"
+#include "../include/DaryPriorityQueue.hpp"
+#include "../include/BucketQueue.hpp"
+#include "../include/EdgeSort.hpp"
+#include "../include/Adjacency.hpp"
+#include "../include/ConcurrentUnionFind.hpp"
+#include "../include/Parallel.hpp"
 #include "../include/UnionFind.hpp"
+#include "../include/RollbackUnionFind.hpp"
+#include "../include/DynamicConnectivity.hpp"
 #include "../include/Algorithms.hpp"
+#include "../include/CSRGraph.hpp"
+#include "../include/EdgeListLoader.hpp"
+#include "../include/EdgeIndex.hpp"
+#include "../include/Landmarks.hpp"
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
 
 using namespace graph;
 
@@ -59,6 +76,100 @@ TEST_CASE("PriorityQueue updateDistance changes priority") {
     CHECK(pq.extractMin() == 1); // should now come first
 }
 
+TEST_CASE("PriorityQueue contains and getDistance track the heap") {
+    PriorityQueue pq(4);
+    pq.insert(2, 7);
+    pq.insert(0, 3);
+
+    CHECK(pq.contains(2));
+    CHECK(pq.contains(0));
+    CHECK(!pq.contains(1));
+    CHECK(!pq.contains(9)); // out of range is simply absent
+    CHECK(pq.getDistance(2) == 7);
+
+    pq.updateDistance(2, 1);
+    CHECK(pq.getDistance(2) == 1);
+    CHECK(pq.extractMin() == 2);
+    CHECK(!pq.contains(2));
+    CHECK(pq.getDistance(2) == std::numeric_limits<int>::max());
+}
+
+TEST_CASE("PriorityQueue increase and decrease keep heap order") {
+    PriorityQueue pq(6);
+    for (int v = 0; v < 6; ++v)
+        pq.insert(v, v * 10);
+
+    pq.updateDistance(0, 100); // increase: root sinks
+    pq.updateDistance(5, 5);   // decrease: leaf rises
+    pq.updateDistance(3, 15);
+
+    int expected[] = {5, 1, 3, 2, 4, 0};
+    for (int v : expected)
+        CHECK(pq.extractMin() == v);
+    CHECK(pq.isEmpty());
+}
+
+TEST_CASE("PriorityQueue rejects invalid inserts") {
+    PriorityQueue pq(2);
+    CHECK_THROWS(pq.insert(2, 1));
+    pq.insert(1, 1);
+    CHECK_THROWS(pq.insert(1, 4));
+}
+
+TEST_CASE("DaryPriorityQueue orders like the binary heap") {
+    DaryPriorityQueue<4> pq(10);
+    int keys[] = {42, 7, 19, 3, 88, 3, 61, 25, 14, 50};
+    for (int v = 0; v < 10; ++v)
+        pq.insert(v, keys[v]);
+
+    pq.updateDistance(4, 1);   // decrease
+    pq.updateDistance(3, 100); // increase
+    CHECK(pq.contains(4));
+    CHECK(pq.getDistance(3) == 100);
+
+    int last = -1;
+    int count = 0;
+    while (!pq.isEmpty()) {
+        int v = pq.extractMin();
+        int key = v == 4 ? 1 : (v == 3 ? 100 : keys[v]);
+        CHECK(key >= last);
+        last = key;
+        ++count;
+    }
+    CHECK(count == 10);
+    CHECK_THROWS(pq.extractMin());
+}
+
+TEST_CASE("BucketQueue extracts in key order") {
+    BucketQueue bq(5, 3);
+    bq.insert(0, 0);
+    for (int v = 1; v < 5; ++v)
+        bq.insert(v, std::numeric_limits<int>::max()); // parked
+
+    CHECK(bq.extractMin() == 0);
+    bq.updateDistance(3, 2);
+    bq.updateDistance(1, 3);
+    bq.updateDistance(2, 1);
+    CHECK(bq.getDistance(3) == 2);
+    CHECK(bq.contains(4));
+
+    CHECK(bq.extractMin() == 2);
+    CHECK(bq.extractMin() == 3);
+    CHECK(bq.extractMin() == 1);
+    CHECK(bq.extractMin() == 4); // infinite keys come last
+    CHECK(bq.isEmpty());
+    CHECK_THROWS(bq.extractMin());
+}
+
+TEST_CASE("BucketQueue rejects keys outside its window") {
+    BucketQueue bq(3, 2);
+    bq.insert(0, 5);
+    CHECK_THROWS(bq.insert(1, 8)); // more than maxWeight ahead
+    CHECK_THROWS(bq.insert(2, -1));
+    CHECK(bq.extractMin() == 0);
+    CHECK_THROWS(bq.insert(1, 4)); // below the last extracted key
+}
+
 //union-find
 TEST_CASE("UnionFind basic connectivity") {
     UnionFind uf(4);
@@ -75,6 +186,198 @@ TEST_CASE("Union-Find  merging") {
     CHECK(!uf.connected(0, 3));
 }
 
+TEST_CASE("UnionFind by size tracks set sizes and count") {
+    UnionFind uf(6, UnionFind::Strategy::BySize);
+    CHECK(uf.numSets() == 6);
+    uf.unite(0, 1);
+    uf.unite(2, 3);
+    uf.unite(1, 3);
+    uf.unite(0, 2); // already joined
+    CHECK(uf.setSize(3) == 4);
+    CHECK(uf.setSize(4) == 1);
+    CHECK(uf.numSets() == 3);
+
+    UnionFind byRank(3);
+    byRank.unite(0, 2);
+    CHECK(byRank.numSets() == 2);
+    CHECK_THROWS(byRank.setSize(0));
+}
+
+TEST_CASE("UnionFind joins a chain of millions of elements") {
+    const int n = 2000000;
+    UnionFind uf(n, UnionFind::Strategy::BySize);
+    for (int i = 1; i < n; ++i)
+        uf.unite(i - 1, i);
+    CHECK(uf.connected(0, n - 1));
+    CHECK(uf.setSize(n / 2) == n);
+    CHECK(uf.numSets() == 1);
+}
+
+//concurrent union-find
+TEST_CASE("ConcurrentUnionFind basic connectivity") {
+    ConcurrentUnionFind uf(4);
+    CHECK(!uf.connected(0, 1));
+    CHECK(uf.unite(0, 1));
+    CHECK(!uf.unite(1, 0)); // already joined
+    uf.unite(2, 3);
+    CHECK(uf.connected(0, 1));
+    CHECK(!uf.connected(1, 2));
+    uf.unite(1, 3);
+    CHECK(uf.find(0) == uf.find(2));
+}
+
+TEST_CASE("ConcurrentUnionFind stress: threads agree with sequential UnionFind") {
+    const int n = 50000;
+    const int unions = 40000;
+    const int threads = 8;
+
+    int* xs = new int[unions];
+    int* ys = new int[unions];
+    unsigned seed = 2024;
+    for (int i = 0; i < unions; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        xs[i] = (seed >> 4) % n;
+        seed = seed * 1103515245u + 12345u;
+        ys[i] = (seed >> 4) % n;
+    }
+
+    ConcurrentUnionFind concurrent(n);
+    std::atomic<int> merges(0);
+    runParallel(threads, [&](int t) {
+        for (int i = t; i < unions; i += threads) {
+            if (concurrent.unite(xs[i], ys[i])) ++merges;
+            concurrent.connected(xs[(i * 7) % unions], ys[i]); // interleave reads
+        }
+    });
+
+    UnionFind sequential(n);
+    int expectedMerges = 0;
+    for (int i = 0; i < unions; ++i) {
+        if (!sequential.connected(xs[i], ys[i])) ++expectedMerges;
+        sequential.unite(xs[i], ys[i]);
+    }
+
+    // Every sequential set is inside one concurrent set, and both made the
+    // same number of merges, so the partitions are identical
+    CHECK(merges.load() == expectedMerges);
+    bool samePartition = true;
+    for (int v = 0; v < n; ++v)
+        if (!concurrent.connected(v, sequential.find(v))) samePartition = false;
+    CHECK(samePartition);
+
+    delete[] xs;
+    delete[] ys;
+}
+
+TEST_CASE("RollbackUnionFind undoes unions back to a snapshot") {
+    RollbackUnionFind uf(6);
+    uf.unite(0, 1);
+    int mark = uf.snapshot();
+    CHECK(uf.unite(2, 3));
+    CHECK(uf.unite(1, 3));
+    CHECK_FALSE(uf.unite(0, 2));
+    CHECK(uf.connected(0, 3));
+    CHECK(uf.numSets() == 3);
+
+    uf.rollback(mark);
+    CHECK(uf.connected(0, 1));
+    CHECK_FALSE(uf.connected(1, 3));
+    CHECK_FALSE(uf.connected(2, 3));
+    CHECK(uf.numSets() == 5);
+
+    uf.rollback(0);
+    CHECK_FALSE(uf.connected(0, 1));
+    CHECK(uf.numSets() == 6);
+    CHECK_THROWS(uf.rollback(1));
+}
+
+TEST_CASE("DynamicConnectivity answers queries over time") {
+    DynamicConnectivity dc(4);
+    int q0 = dc.query(0, 1);
+    dc.addEdge(0, 1);
+    dc.addEdge(1, 2);
+    int q1 = dc.query(0, 2);
+    dc.addEdge(2, 1);       // parallel copy
+    dc.removeEdge(1, 2);
+    int q2 = dc.query(2, 0);
+    dc.removeEdge(2, 1);
+    int q3 = dc.query(0, 2);
+    int q4 = dc.query(3, 3);
+
+    CHECK_THROWS(dc.answer(q0));
+    dc.solve();
+    CHECK(dc.getNumQueries() == 5);
+    CHECK_FALSE(dc.answer(q0));
+    CHECK(dc.answer(q1));
+    CHECK(dc.answer(q2));
+    CHECK_FALSE(dc.answer(q3));
+    CHECK(dc.answer(q4));
+    CHECK_THROWS(dc.answer(5));
+
+    // Invalid removals are rejected when recorded and leave the log usable
+    DynamicConnectivity bad(3);
+    bad.addEdge(0, 1);
+    CHECK_THROWS(bad.removeEdge(1, 2));
+    bad.removeEdge(1, 0);
+    CHECK_THROWS(bad.removeEdge(0, 1));
+    int q = bad.query(0, 1);
+    bad.solve();
+    CHECK_FALSE(bad.answer(q));
+    CHECK_THROWS(bad.addEdge(0, 3));
+    CHECK_THROWS(bad.removeEdge(0, 3));
+
+    // Rejected removals of never-added edges record nothing
+    DynamicConnectivity empty(1000);
+    for (int v = 1; v < 1000; ++v)
+        CHECK_THROWS(empty.removeEdge(0, v));
+    empty.addEdge(0, 1);
+    empty.removeEdge(1, 0);
+    int e = empty.query(0, 1);
+    empty.solve();
+    CHECK_FALSE(empty.answer(e));
+}
+
+TEST_CASE("DynamicConnectivity matches rebuilding a UnionFind per query") {
+    const int n = 12;
+    int count[n][n] = {};
+    DynamicConnectivity dc(n);
+    bool expected[600];
+    int queries = 0;
+    unsigned int seed = 7;
+
+    for (int step = 0; step < 1500; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        int u = (seed >> 8) % n;
+        seed = seed * 1103515245u + 12345u;
+        int v = (seed >> 8) % n;
+        int a = u < v ? u : v, b = u < v ? v : u;
+        int kind = step % 5;
+
+        if (kind < 2) {
+            dc.addEdge(u, v);
+            ++count[a][b];
+        } else if (kind < 4) {
+            if (count[a][b] > 0) {
+                dc.removeEdge(v, u);
+                --count[a][b];
+            }
+        } else if (queries < 600) {
+            UnionFind uf(n);
+            for (int x = 0; x < n; ++x)
+                for (int y = x; y < n; ++y)
+                    if (count[x][y] > 0) uf.unite(x, y);
+            expected[queries++] = uf.connected(u, v);
+            dc.query(u, v);
+        }
+    }
+
+    dc.solve();
+    bool allMatch = true;
+    for (int q = 0; q < queries; ++q)
+        if (dc.answer(q) != expected[q]) allMatch = false;
+    CHECK(allMatch);
+}
+
 // ----------------------------------------------------------
 // Functionality Tests for Graph
 // ----------------------------------------------------------
@@ -431,3 +734,1747 @@ TEST_CASE("Kruskal picks minimal weight edges for MST") {
     // Since edges are undirected and stored twice, divide by 2
     CHECK(totalWeight / 2 == 13);
 }
+
+// ----------------------------------------------------------
+// CSR Backend Tests
+// ----------------------------------------------------------
+
+// Sum of all adjacency entry weights of a tree (each edge counted twice)
+static int totalTreeWeight(const Graph& tree) {
+    int total = 0;
+    for (int i = 0; i < tree.getNumVertices(); ++i) {
+        for (Neighbor* n = tree.getNeighbors(i); n; n = n->next)
+            total += n->weight;
+    }
+    return total;
+}
+
+// True if both graphs have identical neighbor lists (same order)
+static bool sameAdjacency(const Graph& a, const Graph& b) {
+    if (a.getNumVertices() != b.getNumVertices()) return false;
+    for (int i = 0; i < a.getNumVertices(); ++i) {
+        Neighbor* x = a.getNeighbors(i);
+        Neighbor* y = b.getNeighbors(i);
+        while (x && y) {
+            if (x->vertex != y->vertex || x->weight != y->weight) return false;
+            x = x->next;
+            y = y->next;
+        }
+        if (x || y) return false;
+    }
+    return true;
+}
+
+TEST_CASE("CSRGraph built from Graph keeps neighbor order") {
+    Graph g(4);
+    g.addEdge(0, 1, 5);
+    g.addEdge(0, 2, 3);
+    g.addEdge(2, 3, 7);
+
+    CSRGraph csr(g);
+    CHECK(csr.getNumVertices() == 4);
+    CHECK(csr.getNumEntries() == 6);
+    CHECK(csr.degree(0) == 2);
+    CHECK(csr.degree(3) == 1);
+
+    int i = csr.begin(0);
+    for (Neighbor* n = g.getNeighbors(0); n; n = n->next, ++i) {
+        CHECK(csr.target(i) == n->vertex);
+        CHECK(csr.weight(i) == n->weight);
+    }
+    CHECK(i == csr.end(0));
+}
+
+TEST_CASE("CSRGraph built from edge list matches addEdge order") {
+    Edge edges[] = {{0, 1, 4}, {0, 2, 1}, {1, 2, 2}, {1, 3, 5}, {2, 3, 8}, {3, 4, 3}};
+    Graph g(5);
+    for (const Edge& e : edges)
+        g.addEdge(e.u, e.v, e.weight);
+
+    CSRGraph fromEdges(5, edges, 6);
+    CSRGraph fromGraph(g);
+    for (int v = 0; v < 5; ++v) {
+        CHECK(fromEdges.degree(v) == fromGraph.degree(v));
+        for (int i = fromEdges.begin(v); i < fromEdges.end(v); ++i) {
+            CHECK(fromEdges.target(i) == fromGraph.target(i));
+            CHECK(fromEdges.weight(i) == fromGraph.weight(i));
+        }
+    }
+}
+
+TEST_CASE("CSRGraph invalid input throws") {
+    Edge bad[] = {{0, 3, 1}};
+    CHECK_THROWS(CSRGraph(2, bad, 1));
+    // 2 * edgeCount would overflow int; rejected before the edges are read
+    CHECK_THROWS(CSRGraph(2, bad, 1100000000));
+
+    Graph g(2);
+    CSRGraph csr(g);
+    CHECK_THROWS(csr.degree(2));
+}
+
+TEST_CASE("Algorithms on CSRGraph match adjacency list results") {
+    Graph g(6);
+    g.addEdge(0, 1, 4);
+    g.addEdge(0, 2, 1);
+    g.addEdge(1, 2, 2);
+    g.addEdge(1, 3, 5);
+    g.addEdge(2, 3, 8);
+    g.addEdge(3, 4, 3);
+    g.addEdge(4, 5, 6);
+    g.addEdge(2, 5, 9);
+    CSRGraph csr(g);
+
+    CHECK(sameAdjacency(Algorithms::bfs(g, 0), Algorithms::bfs(csr, 0)));
+    CHECK(sameAdjacency(Algorithms::dfs(g, 0), Algorithms::dfs(csr, 0)));
+    CHECK(sameAdjacency(Algorithms::dijkstra(g, 0), Algorithms::dijkstra(csr, 0)));
+    CHECK(sameAdjacency(Algorithms::prim(g), Algorithms::prim(csr)));
+    CHECK(sameAdjacency(Algorithms::kruskal(g), Algorithms::kruskal(csr)));
+    CHECK(totalTreeWeight(Algorithms::kruskal(csr)) / 2 == 17);
+    CHECK_THROWS(Algorithms::bfs(csr, 6));
+}
+
+
+// ----------------------------------------------------------
+// Neighbor Arena Tests
+// ----------------------------------------------------------
+
+TEST_CASE("NeighborPool reuses released nodes") {
+    NeighborPool pool;
+    Neighbor* a = pool.allocate(1, 10, nullptr);
+    Neighbor* b = pool.allocate(2, 20, a);
+    CHECK(b->next == a);
+    CHECK(b->vertex == 2);
+
+    pool.deallocate(a);
+    Neighbor* c = pool.allocate(3, 30, nullptr);
+    CHECK(c == a); // released slot is handed out again
+    CHECK(c->vertex == 3);
+    CHECK(c->weight == 30);
+}
+
+TEST_CASE("Graph with many edges and removals stays consistent") {
+    const int n = 200;
+    Graph g(n);
+    for (int i = 0; i + 1 < n; ++i)
+        g.addEdge(i, i + 1, i);
+    for (int i = 0; i + 1 < n; i += 2)
+        g.removeEdge(i, i + 1);
+    for (int i = 0; i + 2 < n; i += 2)
+        g.addEdge(i, i + 2, 1);
+
+    int entries = 0;
+    for (int i = 0; i < n; ++i)
+        for (Neighbor* nb = g.getNeighbors(i); nb; nb = nb->next)
+            ++entries;
+    CHECK(entries == 2 * (99 + 99)); // 99 path edges left + 99 skip edges
+}
+
+TEST_CASE("addEdges matches addEdge called per edge") {
+    const int n = 40;
+    const int m = 300;
+    Edge* edges = new Edge[m];
+    unsigned int seed = 5;
+    for (int i = 0; i < m; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int u = (seed >> 8) % n;
+        seed = seed * 1103515245u + 12345u;
+        edges[i] = {u, (int)((seed >> 8) % n), i % 17}; // includes loops and parallel edges
+    }
+
+    Graph one(n), bulk(n);
+    for (int i = 0; i < 20; ++i) { // existing edges stay behind the new ones
+        one.addEdge(i, i + 1, 100 + i);
+        bulk.addEdge(i, i + 1, 100 + i);
+    }
+    for (int i = 0; i < m; ++i)
+        one.addEdge(edges[i].u, edges[i].v, edges[i].weight);
+    bulk.addEdges(edges, m);
+    CHECK(sameAdjacency(one, bulk));
+
+    // Removals and later insertions keep working on bulk-allocated nodes
+    for (int i = 0; i < m; i += 3) {
+        one.removeEdge(edges[i].u, edges[i].v);
+        bulk.removeEdge(edges[i].u, edges[i].v);
+    }
+    one.addEdges(edges, 50);
+    bulk.addEdges(edges, 50);
+    one.addEdge(3, 4, 9);
+    bulk.addEdge(3, 4, 9);
+    CHECK(sameAdjacency(one, bulk));
+
+    GraphBuilder builder(n);
+    builder.reserve(m);
+    for (int i = 0; i < m; ++i)
+        builder.addEdge(edges[i].u, edges[i].v, edges[i].weight);
+    CHECK(builder.getNumEdges() == (size_t)m);
+    Graph built = builder.build();
+    Graph expected(n);
+    expected.addEdges(edges, m);
+    CHECK(sameAdjacency(built, expected));
+    delete[] edges;
+}
+
+TEST_CASE("addEdges validates before changing the graph") {
+    Graph g(3);
+    g.addEdge(0, 1, 2);
+    Edge bad[] = {{1, 2, 3}, {2, 3, 1}};
+    CHECK_THROWS(g.addEdges(bad, 2));
+    CHECK(g.getNeighbors(2) == nullptr);
+    g.addEdges(bad, 0);
+    CHECK(g.getNeighbors(1)->vertex == 0);
+
+    GraphBuilder builder(3);
+    CHECK_THROWS(builder.addEdge(0, 3, 1));
+    CHECK_THROWS(GraphBuilder(-1));
+    CHECK(builder.build().getNeighbors(0) == nullptr);
+}
+
+TEST_CASE("hasEdge, getWeight and updateWeight") {
+    Graph g(4);
+    g.addEdge(0, 1, 5);
+    g.addEdge(1, 2, 3);
+    g.addEdge(2, 2, 8);
+
+    for (int pass = 0; pass < 2; ++pass) {
+        CHECK(g.hasEdge(0, 1));
+        CHECK(g.hasEdge(1, 0));
+        CHECK_FALSE(g.hasEdge(0, 2));
+        CHECK(g.getWeight(2, 1) == 3);
+        CHECK_THROWS(g.getWeight(0, 3));
+        CHECK_THROWS(g.updateWeight(3, 0, 1));
+        CHECK_THROWS(g.hasEdge(0, 4));
+        g.enableEdgeIndex();
+        CHECK(g.hasEdgeIndex());
+    }
+
+    g.updateWeight(1, 0, 7);
+    CHECK(g.getWeight(0, 1) == 7);
+    g.updateWeight(2, 2, 4);
+    int loopWeights = 0;
+    for (Neighbor* n = g.getNeighbors(2); n; n = n->next)
+        if (n->vertex == 2) loopWeights += n->weight;
+    CHECK(loopWeights == 8);
+
+    g.removeEdge(2, 2);
+    CHECK_FALSE(g.hasEdge(2, 2));
+    g.disableEdgeIndex();
+    CHECK_FALSE(g.hasEdgeIndex());
+    CHECK(g.getWeight(1, 0) == 7);
+}
+
+TEST_CASE("Edge index keeps lists identical to the unindexed graph") {
+    const int n = 30;
+    Graph plain(n), indexed(n);
+    indexed.enableEdgeIndex();
+    Edge batch[40];
+    unsigned int seed = 9;
+    bool sameLookups = true;
+
+    for (int step = 0; step < 6000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        int u = (seed >> 8) % n;
+        seed = seed * 1103515245u + 12345u;
+        int v = (seed >> 8) % n;
+        int kind = (seed >> 20) % 10;
+
+        if (kind < 4) {
+            plain.addEdge(u, v, step % 23);
+            indexed.addEdge(u, v, step % 23);
+        } else if (kind < 8) {
+            plain.removeEdge(u, v);
+            indexed.removeEdge(u, v);
+        } else if (kind == 8) {
+            if (plain.hasEdge(u, v)) {
+                plain.updateWeight(u, v, step);
+                indexed.updateWeight(u, v, step);
+            }
+        } else {
+            for (int i = 0; i < 40; ++i)
+                batch[i] = {(u + i) % n, (v * i + 1) % n, i};
+            plain.addEdges(batch, 40);
+            indexed.addEdges(batch, 40);
+        }
+
+        if (plain.hasEdge(u, v) != indexed.hasEdge(u, v) ||
+            (plain.hasEdge(u, v) && plain.getWeight(u, v) != indexed.getWeight(u, v)))
+            sameLookups = false;
+        if (step == 3000) { // rebuilding from the lists gives the same index
+            indexed.disableEdgeIndex();
+            indexed.enableEdgeIndex();
+        }
+    }
+    CHECK(sameLookups);
+    CHECK(sameAdjacency(plain, indexed));
+
+    Graph moved(std::move(indexed));
+    CHECK(moved.hasEdgeIndex());
+    CHECK_FALSE(indexed.hasEdgeIndex());
+}
+
+TEST_CASE("EdgeIndex insert, find and erase") {
+    EdgeIndex index;
+    for (int i = 0; i < 1000; ++i)
+        index.findOrAdd(i % 37, i)->count = i;
+    CHECK(index.getSize() == 1000);
+    for (int i = 0; i < 1000; i += 2)
+        index.erase(i % 37, i);
+    index.erase(5, 5000);
+    CHECK(index.getSize() == 500);
+    bool ok = true;
+    for (int i = 0; i < 1000; ++i) {
+        EdgeIndex::Entry* entry = index.find(i % 37, i);
+        if ((i % 2 == 0) != (entry == nullptr) || (entry && entry->count != i)) ok = false;
+    }
+    CHECK(ok);
+}
+
+TEST_CASE("Directed graph stores out-neighbors only") {
+    Graph g(4, true);
+    CHECK(g.isDirected());
+    g.addEdge(0, 1, 5);
+    g.addEdge(1, 2, 3);
+    g.addEdge(2, 0, 4);
+    g.addEdge(0, 1, 9);
+
+    CHECK(g.hasEdge(0, 1));
+    CHECK_FALSE(g.hasEdge(1, 0));
+    CHECK(g.getWeight(0, 1) == 9);
+    CHECK(g.getNeighbors(3) == nullptr);
+    g.updateWeight(2, 0, 6);
+    CHECK(g.getWeight(2, 0) == 6);
+
+    g.removeEdge(1, 0); // no such directed edge
+    CHECK(g.hasEdge(0, 1));
+    g.removeEdge(0, 1);
+    CHECK(g.getWeight(0, 1) == 5);
+
+    Graph t = g.transpose();
+    CHECK(t.isDirected());
+    CHECK(t.hasEdge(1, 0));
+    CHECK(t.hasEdge(0, 2));
+    CHECK_FALSE(t.hasEdge(0, 1));
+    CHECK(t.getWeight(0, 2) == 6);
+    CHECK_THROWS(Graph(2).transpose());
+
+    g.enableEdgeIndex();
+    g.addEdge(3, 0, 1);
+    g.removeEdge(0, 1);
+    CHECK_FALSE(g.hasEdge(0, 1));
+    CHECK(g.hasEdge(3, 0));
+    CHECK_FALSE(g.hasEdge(0, 3));
+}
+
+TEST_CASE("Directed bulk insertion and CSR") {
+    Edge edges[] = {{0, 1, 2}, {1, 2, 4}, {0, 2, 7}, {2, 3, 1}, {0, 1, 3}};
+    Graph one(4, true), bulk(4, true);
+    for (const Edge& e : edges)
+        one.addEdge(e.u, e.v, e.weight);
+    bulk.addEdges(edges, 5);
+    CHECK(sameAdjacency(one, bulk));
+    CHECK(bulk.getNeighbors(3) == nullptr);
+
+    CSRGraph fromGraph(one);
+    CSRGraph fromEdges(4, edges, 5, true);
+    CHECK(fromGraph.isDirected());
+    CHECK(fromEdges.getNumEntries() == 5);
+    bool sameRows = true;
+    for (int i = 0; i < 5; ++i)
+        if (fromGraph.target(i) != fromEdges.target(i) || fromGraph.weight(i) != fromEdges.weight(i))
+            sameRows = false;
+    CHECK(sameRows);
+
+    GraphBuilder builder(4, true);
+    builder.addEdge(2, 1, 1);
+    CHECK(builder.build().getNeighbors(1) == nullptr);
+
+    const char* path = "test_graph.csr";
+    fromEdges.save(path);
+    CSRGraph mapped(path);
+    CHECK(mapped.isDirected());
+    CHECK(mapped.getNumEntries() == 5);
+    std::remove(path);
+}
+
+TEST_CASE("Traversals and Dijkstra follow edge directions") {
+    // 0 -> 1 -> 2 -> 3 and a heavy shortcut 0 -> 3; 4 -> 0 is not reachable from 0
+    Graph g(5, true);
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 2, 1);
+    g.addEdge(2, 3, 1);
+    g.addEdge(0, 3, 10);
+    g.addEdge(4, 0, 1);
+    CSRGraph csr(g);
+
+    TraversalResult bfs = Algorithms::bfsTraversal(g, 0);
+    CHECK(bfs.visitedCount == 4);
+    CHECK(bfs.depth[3] == 1);
+    CHECK_FALSE(bfs.visited(4));
+    CHECK(Algorithms::bfsTraversal(g, 3).visitedCount == 1);
+    CHECK(Algorithms::bfsDirectionOptimizingTraversal(csr, 0, 1, 1).depth[3] == 1);
+    CHECK(Algorithms::parallelBfsTraversal(csr, 0, 2).visitedCount == 4);
+
+    TraversalResult dfs = Algorithms::dfsTraversal(csr, 0);
+    CHECK(dfs.visitedCount == 4);
+    CHECK_FALSE(dfs.visited(4));
+
+    ShortestPathResult sp = Algorithms::dijkstraDistances(g, 0);
+    CHECK(sp.dist[3] == 3);
+    CHECK(sp.parent[3] == 2);
+    CHECK_FALSE(sp.reachable(4));
+    CHECK(Algorithms::dijkstraDistances(g, 4).dist[3] == 4);
+
+    Graph tree = Algorithms::dijkstra(csr, 0);
+    CHECK(tree.isDirected());
+    CHECK(tree.hasEdge(2, 3));
+    CHECK_FALSE(tree.hasEdge(3, 2));
+    CHECK(Algorithms::bfs(g, 0).isDirected());
+    CHECK(Algorithms::dfs(g, 0).hasEdge(0, 1));
+    CHECK(Algorithms::dijkstraBuckets(g, 0).getWeight(2, 3) == 1);
+
+    CHECK_THROWS(Algorithms::prim(g));
+    CHECK_THROWS(Algorithms::kruskal(csr));
+    CHECK_THROWS(Algorithms::kruskal(g, 2));
+    CHECK_THROWS(Algorithms::boruvka(g));
+}
+
+TEST_CASE("Graph move transfers ownership") {
+    Graph g(3);
+    g.addEdge(0, 1, 5);
+
+    Graph moved(std::move(g));
+    CHECK(moved.getNumVertices() == 3);
+    CHECK(moved.getNeighbors(0)->vertex == 1);
+    CHECK(g.getNumVertices() == 0);
+
+    Graph other(1);
+    other = std::move(moved);
+    CHECK(other.getNumVertices() == 3);
+    CHECK(other.getNeighbors(1)->vertex == 0);
+}
+
+TEST_CASE("Dijkstra and Prim give the same trees with d-ary heaps") {
+    Graph g(6);
+    g.addEdge(0, 1, 4);
+    g.addEdge(0, 2, 1);
+    g.addEdge(1, 2, 2);
+    g.addEdge(1, 3, 5);
+    g.addEdge(2, 3, 8);
+    g.addEdge(3, 4, 3);
+    g.addEdge(4, 5, 6);
+    g.addEdge(2, 5, 9);
+    CSRGraph csr(g);
+
+    Graph expected = Algorithms::dijkstra(g, 0);
+    CHECK(sameAdjacency(expected, Algorithms::dijkstra<DaryPriorityQueue<2>>(g, 0)));
+    CHECK(sameAdjacency(expected, Algorithms::dijkstra<DaryPriorityQueue<4>>(g, 0)));
+    CHECK(sameAdjacency(expected, Algorithms::dijkstra<DaryPriorityQueue<8>>(csr, 0)));
+
+    CHECK(totalTreeWeight(Algorithms::prim<DaryPriorityQueue<4>>(g)) / 2 == 17);
+    CHECK(totalTreeWeight(Algorithms::prim<DaryPriorityQueue<8>>(csr)) / 2 == 17);
+}
+
+TEST_CASE("Dijkstra with buckets matches the heap version") {
+    Graph g(6);
+    g.addEdge(0, 1, 4);
+    g.addEdge(0, 2, 1);
+    g.addEdge(1, 2, 2);
+    g.addEdge(1, 3, 5);
+    g.addEdge(2, 3, 8);
+    g.addEdge(3, 4, 3);
+    g.addEdge(4, 5, 6);
+    g.addEdge(2, 5, 9);
+    CSRGraph csr(g);
+
+    Graph expected = Algorithms::dijkstra(g, 0);
+    CHECK(sameAdjacency(expected, Algorithms::dijkstraBuckets(g, 0)));
+    CHECK(sameAdjacency(expected, Algorithms::dijkstraBuckets(csr, 0)));
+    CHECK(sameAdjacency(expected, Algorithms::dijkstraBuckets(g, 0, 4))); // heap fallback
+}
+
+TEST_CASE("Dijkstra with buckets builds the same tree when paths tie") {
+    // Weights 0-3 make equal-length paths and zero-weight edges common
+    unsigned seed = 2024;
+    bool sameTree = true, sameDist = true;
+    for (int round = 0; round < 300; ++round) {
+        int n = 2 + round % 40;
+        Graph g(n);
+        for (int i = 0; i < 3 * n; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 8) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 8) % n;
+            g.addEdge(u, v, (seed >> 4) % 4);
+        }
+        CSRGraph csr(g);
+        int source = round % n;
+
+        Graph expected = Algorithms::dijkstra(g, source);
+        if (!sameAdjacency(expected, Algorithms::dijkstraBuckets(g, source)) ||
+            !sameAdjacency(expected, Algorithms::dijkstraBuckets(csr, source)) ||
+            !sameAdjacency(expected, Algorithms::dijkstra<DaryPriorityQueue<4>>(g, source)))
+            sameTree = false;
+
+        ShortestPathResult heap = Algorithms::dijkstraDistances(g, source);
+        ShortestPathResult fromCsr = Algorithms::dijkstraDistances(csr, source);
+        for (int v = 0; v < n; ++v)
+            if (heap.dist[v] != fromCsr.dist[v] || heap.parent[v] != fromCsr.parent[v]) sameDist = false;
+    }
+    CHECK(sameTree);
+    CHECK(sameDist);
+}
+
+// The original Dijkstra: every vertex in the binary heap up front, strict
+// relaxation only, so the parent is the first tight predecessor extracted
+static void baselineDijkstra(const Graph& g, int source, int* dist, int* parent) {
+    int n = g.getNumVertices();
+    bool* visited = new bool[n]();
+    PriorityQueue pq(n);
+    for (int i = 0; i < n; ++i) {
+        dist[i] = std::numeric_limits<int>::max();
+        parent[i] = -1;
+    }
+    dist[source] = 0;
+    for (int i = 0; i < n; ++i)
+        pq.insert(i, dist[i]);
+    while (!pq.isEmpty()) {
+        int u = pq.extractMin();
+        visited[u] = true;
+        for (Neighbor* nb = g.getNeighbors(u); nb != nullptr; nb = nb->next) {
+            int v = nb->vertex;
+            if (dist[u] != std::numeric_limits<int>::max() && !visited[v] && dist[u] + nb->weight < dist[v]) {
+                dist[v] = dist[u] + nb->weight;
+                parent[v] = u;
+                pq.updateDistance(v, dist[v]);
+            }
+        }
+    }
+    delete[] visited;
+}
+
+TEST_CASE("Dijkstra tie rule differs from the baseline tree only on ties") {
+    unsigned seed = 77;
+    bool sameDist = true, sameUnique = true, ruleOnTies = true;
+    int ties = 0;
+    for (int round = 0; round < 200; ++round) {
+        int n = 2 + round % 50;
+        Graph g(n);
+        for (int i = 0; i < 3 * n; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 8) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 8) % n;
+            g.addEdge(u, v, 1 + (seed >> 4) % 4);
+        }
+        int source = round % n;
+        int* dist = new int[n];
+        int* parent = new int[n];
+        baselineDijkstra(g, source, dist, parent);
+        ShortestPathResult r = Algorithms::dijkstraDistances(g, source);
+
+        for (int v = 0; v < n; ++v) {
+            if (r.dist[v] != dist[v]) sameDist = false;
+            if (v == source || !r.reachable(v)) continue;
+            // Tight predecessors of v; the tie rule keeps the smallest
+            int count = 0, smallest = n;
+            for (Neighbor* nb = g.getNeighbors(v); nb != nullptr; nb = nb->next) {
+                int u = nb->vertex;
+                if (u != v && r.reachable(u) && r.dist[u] + nb->weight == r.dist[v]) {
+                    ++count;
+                    if (u < smallest) smallest = u;
+                }
+            }
+            if (count == 1 && r.parent[v] != parent[v]) sameUnique = false;
+            if (count > 1) {
+                ++ties;
+                if (r.parent[v] != smallest) ruleOnTies = false;
+            }
+        }
+        delete[] dist;
+        delete[] parent;
+    }
+    CHECK(sameDist);
+    CHECK(sameUnique);
+    CHECK(ruleOnTies);
+    CHECK(ties > 0);
+}
+
+TEST_CASE("Dijkstra with buckets handles unreachable and negative edges") {
+    Graph g(4);
+    g.addEdge(0, 1, 0);
+    g.addEdge(2, 3, 1);
+    Graph tree = Algorithms::dijkstraBuckets(g, 0);
+    CHECK(tree.getNeighbors(0)->vertex == 1);
+    CHECK(tree.getNeighbors(2) == nullptr);
+
+    g.addEdge(1, 2, -3);
+    CHECK_THROWS_WITH(Algorithms::dijkstraBuckets(g, 0),
+                      "Graph contains a negative weight edge – Dijkstra is not allowed");
+}
+
+
+// ----------------------------------------------------------
+// CSR File Tests
+// ----------------------------------------------------------
+
+TEST_CASE("CSRGraph saved to disk and mapped back") {
+    const char* path = "test_graph.csr";
+    Graph g(7);
+    g.addEdge(0, 1, 4);
+    g.addEdge(0, 2, 1);
+    g.addEdge(1, 2, 2);
+    g.addEdge(1, 3, 5);
+    g.addEdge(2, 3, 8);
+    g.addEdge(3, 4, 3);
+    g.addEdge(4, 5, 6);
+    for (int i = 0; i < 30; ++i)
+        g.addEdge((i * 5) % 6, (i * 7 + 3) % 6, 1 + i % 9); // loops and parallel edges too
+
+    SUBCASE("from an adjacency list") {
+        CSRGraph::save(g, path);
+    }
+    SUBCASE("from a CSRGraph") {
+        CSRGraph(g).save(path);
+    }
+
+    CSRGraph mapped(path);
+    CSRGraph csr(g);
+    CHECK(mapped.isMapped());
+    CHECK_FALSE(csr.isMapped());
+    CHECK(mapped.getNumVertices() == 7);
+    CHECK(mapped.getNumEntries() == csr.getNumEntries());
+    CHECK(mapped.degree(6) == 0);
+
+    bool sameRows = true;
+    for (int v = 0; v < 7; ++v) {
+        if (mapped.begin(v) != csr.begin(v) || mapped.end(v) != csr.end(v))
+            sameRows = false;
+        for (int i = csr.begin(v); i < csr.end(v); ++i)
+            if (mapped.target(i) != csr.target(i) || mapped.weight(i) != csr.weight(i))
+                sameRows = false;
+    }
+    CHECK(sameRows);
+
+    CHECK(sameAdjacency(Algorithms::bfs(g, 0), Algorithms::bfs(mapped, 0)));
+    CHECK(sameAdjacency(Algorithms::dijkstra(g, 0), Algorithms::dijkstra(mapped, 0)));
+    CHECK(sameAdjacency(Algorithms::kruskal(g), Algorithms::kruskal(mapped)));
+    std::remove(path);
+}
+
+TEST_CASE("CSRGraph opens version 1 files") {
+    // Version 1: 32-byte header without flags, then the three arrays
+    const char* path = "test_graph.csr";
+    std::FILE* file = std::fopen(path, "wb");
+    const char magic[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+    unsigned int version = 1, byteOrder = 0x01020304;
+    long long n = 2, entries = 2;
+    int arrays[] = {0, 1, 2, 1, 0, 7, 7};
+    std::fwrite(magic, 1, 8, file);
+    std::fwrite(&version, 4, 1, file);
+    std::fwrite(&byteOrder, 4, 1, file);
+    std::fwrite(&n, 8, 1, file);
+    std::fwrite(&entries, 8, 1, file);
+    std::fwrite(arrays, sizeof(int), 7, file);
+    std::fclose(file);
+
+    CSRGraph g(path);
+    CHECK_FALSE(g.isDirected());
+    CHECK(g.degree(0) == 1);
+    CHECK(g.target(g.begin(1)) == 0);
+    CHECK(g.weight(0) == 7);
+    std::remove(path);
+}
+
+TEST_CASE("CSRGraph rejects missing and corrupt files") {
+    const char* path = "test_graph.csr";
+    CHECK_THROWS(CSRGraph("no_such_graph.csr"));
+
+    Graph g(3);
+    g.addEdge(0, 1, 2);
+    CSRGraph::save(g, path);
+
+    // Truncated file
+    std::FILE* file = std::fopen(path, "r+b");
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fclose(file);
+    REQUIRE(truncate(path, size - 4) == 0);
+    CHECK_THROWS(CSRGraph(path));
+
+    // Corrupt offsets and targets open in O(1) but fail validate()
+    Graph square(4);
+    square.addEdge(0, 1, 1);
+    square.addEdge(1, 2, 1);
+    square.addEdge(2, 3, 1);
+    CSRGraph::save(square, path);
+    CSRGraph(path).validate();
+    const long offsetsAt = 40, targetsAt = offsetsAt + 5 * sizeof(int);
+    int bad = 0; // offsets become 0 1 0 5 6
+    file = std::fopen(path, "r+b");
+    std::fseek(file, offsetsAt + 2 * sizeof(int), SEEK_SET);
+    std::fwrite(&bad, sizeof(int), 1, file);
+    std::fclose(file);
+    CHECK_THROWS(CSRGraph(path).validate());
+
+    CSRGraph::save(square, path);
+    bad = 4;
+    file = std::fopen(path, "r+b");
+    std::fseek(file, targetsAt + sizeof(int), SEEK_SET);
+    std::fwrite(&bad, sizeof(int), 1, file);
+    std::fclose(file);
+    CSRGraph outOfRange(path);
+    CHECK_THROWS(outOfRange.validate());
+
+    // Wrong magic
+    CSRGraph::save(g, path);
+    file = std::fopen(path, "r+b");
+    std::fputc('X', file);
+    std::fclose(file);
+    CHECK_THROWS(CSRGraph(path));
+    std::remove(path);
+}
+
+// ----------------------------------------------------------
+// Edge List Loader Tests
+// ----------------------------------------------------------
+
+// Write text to path, replacing any previous content
+static void writeTextFile(const char* path, const char* text) {
+    std::FILE* file = std::fopen(path, "w");
+    std::fputs(text, file);
+    std::fclose(file);
+}
+
+TEST_CASE("loadEdgeList parses edges, comments and blank lines") {
+    const char* path = "test_edges.txt";
+    writeTextFile(path,
+        "# small graph\n"
+        "0 1 4\n"
+        "\n"
+        "0\t2  1   # inline comment\r\n"
+        "  1 2 -2\n"
+        "4 3 7");
+
+    int n = 0, count = 0;
+    Edge* edges = parseEdgeList(path, n, count);
+    CHECK(n == 5);
+    REQUIRE(count == 4);
+    CHECK(edges[1].u == 0);
+    CHECK(edges[1].v == 2);
+    CHECK(edges[1].weight == 1);
+    CHECK(edges[2].weight == -2);
+    CHECK(edges[3].u == 4);
+    delete[] edges;
+
+    Graph g(5);
+    g.addEdge(0, 1, 4);
+    g.addEdge(0, 2, 1);
+    g.addEdge(1, 2, -2);
+    g.addEdge(4, 3, 7);
+    CSRGraph loaded = loadEdgeList(path);
+    CSRGraph expected(g);
+    CHECK(loaded.getNumVertices() == 5);
+    bool sameRows = loaded.getNumEntries() == expected.getNumEntries();
+    for (int i = 0; sameRows && i < expected.getNumEntries(); ++i)
+        if (loaded.target(i) != expected.target(i) || loaded.weight(i) != expected.weight(i))
+            sameRows = false;
+    CHECK(sameRows);
+
+    writeTextFile(path, "");
+    CSRGraph empty = loadEdgeList(path);
+    CHECK(empty.getNumVertices() == 0);
+    std::remove(path);
+}
+
+TEST_CASE("loadEdgeList rejects malformed lines") {
+    const char* path = "test_edges.txt";
+    const char* bad[] = {"0 1\n", "0 1 2 3\n", "0 -1 2\n", "0 1 x\n", "0 1 2.5\n",
+                         "0 1\n2\n", "0 1 99999999999\n", "0 1 2\n2\n"};
+    long long lines[] = {1, 1, 1, 1, 1, 1, 1, 2};
+    for (int i = 0; i < 8; ++i) {
+        writeTextFile(path, bad[i]);
+        long long errorLine = -1;
+        CHECK_THROWS(loadEdgeList(path, 0, &errorLine));
+        CHECK(errorLine == lines[i]);
+    }
+    writeTextFile(path, "# header\n0 1 2\n\n1 2 3 # ok\n2 x 1\n3 4 5\n");
+    long long errorLine = -1;
+    CHECK_THROWS(loadEdgeList(path, 0, &errorLine));
+    CHECK(errorLine == 5);
+    std::remove(path);
+    CHECK_THROWS(loadEdgeList("no_such_edges.txt", 0, &errorLine));
+    CHECK(errorLine == 0);
+}
+
+TEST_CASE("parseEdgeList and loadEdgeList give the same result for any thread count") {
+    const char* path = "test_edges.txt";
+    const int lines = 300000; // about 5 MB, enough for several chunks
+    std::FILE* file = std::fopen(path, "w");
+    unsigned int seed = 3;
+    for (int i = 0; i < lines; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        std::fprintf(file, "%d %d %d\n", i % 50000, (seed >> 8) % 50000, (int)(seed % 2001) - 1000);
+        if (i % 1000 == 0) std::fprintf(file, "# checkpoint %d\n", i);
+    }
+    std::fclose(file);
+
+    int n1 = 0, count1 = 0;
+    Edge* sequential = parseEdgeList(path, n1, count1, 1);
+    CHECK(count1 == lines);
+    for (int threads : {2, 3, 8}) {
+        int n = 0, count = 0;
+        Edge* parallel = parseEdgeList(path, n, count, threads);
+        bool same = n == n1 && count == count1;
+        for (int i = 0; same && i < count; ++i)
+            if (parallel[i].u != sequential[i].u || parallel[i].v != sequential[i].v ||
+                parallel[i].weight != sequential[i].weight)
+                same = false;
+        CHECK(same);
+        delete[] parallel;
+
+        //loadEdgeList scatters the per-thread buffers without concatenating them
+        CSRGraph expected(n1, sequential, count1);
+        CSRGraph loaded = loadEdgeList(path, threads);
+        same = loaded.getNumVertices() == n1 && loaded.getNumEntries() == expected.getNumEntries();
+        for (int v = 0; same && v < n1; ++v)
+            same = loaded.begin(v) == expected.begin(v) && loaded.end(v) == expected.end(v);
+        for (int i = 0; same && i < expected.getNumEntries(); ++i)
+            same = loaded.target(i) == expected.target(i) && loaded.weight(i) == expected.weight(i);
+        CHECK(same);
+    }
+    delete[] sequential;
+    std::remove(path);
+}
+
+// ----------------------------------------------------------
+// Array Result API Tests
+// ----------------------------------------------------------
+
+TEST_CASE("dijkstraDistances returns distances and parents") {
+    Graph g(5);
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 2, 2);
+    g.addEdge(0, 2, 10);
+    g.addEdge(2, 3, 1);
+
+    ShortestPathResult r = Algorithms::dijkstraDistances(g, 0);
+    CHECK(r.source == 0);
+    CHECK(r.dist[0] == 0);
+    CHECK(r.dist[2] == 3);
+    CHECK(r.dist[3] == 4);
+    CHECK(r.parent[2] == 1);
+    CHECK(r.parent[0] == -1);
+    CHECK(!r.reachable(4));
+    CHECK(r.parent[4] == -1);
+
+    CSRGraph csr(g);
+    ShortestPathResult c = Algorithms::dijkstraDistances(csr, 0);
+    for (int v = 0; v < 5; ++v) {
+        CHECK(c.dist[v] == r.dist[v]);
+        CHECK(c.parent[v] == r.parent[v]);
+    }
+}
+
+TEST_CASE("bfsTraversal gives level order, parents and depths") {
+    Graph g(6);
+    g.addEdge(0, 1, 1);
+    g.addEdge(0, 2, 1);
+    g.addEdge(1, 3, 1);
+    g.addEdge(2, 3, 1);
+    g.addEdge(3, 4, 1);
+
+    TraversalResult r = Algorithms::bfsTraversal(g, 0);
+    CHECK(r.visitedCount == 5);
+    CHECK(r.order[0] == 0);
+    CHECK(r.depth[3] == 2);
+    CHECK(r.depth[4] == 3);
+    CHECK(r.parent[4] == 3);
+    CHECK(!r.visited(5));
+    for (int i = 1; i < r.visitedCount; ++i)
+        CHECK(r.depth[r.order[i - 1]] <= r.depth[r.order[i]]);
+}
+
+TEST_CASE("dfsTraversal follows the DFS tree") {
+    Graph g(4);
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 2, 1);
+    g.addEdge(2, 3, 1);
+    g.addEdge(0, 3, 1);
+
+    TraversalResult r = Algorithms::dfsTraversal(g, 0);
+    Graph tree = Algorithms::dfs(g, 0);
+    CHECK(r.visitedCount == 4);
+    CHECK(r.order[0] == 0);
+    for (int v = 1; v < 4; ++v) {
+        bool inTree = false;
+        for (Neighbor* n = tree.getNeighbors(v); n; n = n->next)
+            if (n->vertex == r.parent[v]) inTree = true;
+        CHECK(inTree);
+        CHECK(r.depth[v] == r.depth[r.parent[v]] + 1);
+    }
+    CHECK_THROWS(Algorithms::dfsTraversal(g, 4));
+}
+
+TEST_CASE("Result structs move their arrays") {
+    Graph g(3);
+    g.addEdge(0, 1, 2);
+    ShortestPathResult r = Algorithms::dijkstraDistances(g, 0);
+    ShortestPathResult moved(std::move(r));
+    CHECK(moved.dist[1] == 2);
+    CHECK(r.dist == nullptr);
+
+    TraversalResult t = Algorithms::bfsTraversal(g, 0);
+    TraversalResult other = Algorithms::bfsTraversal(g, 2);
+    other = std::move(t);
+    CHECK(other.visitedCount == 2);
+    CHECK(other.source == 0);
+}
+
+// ----------------------------------------------------------
+// Vertex/Weight Type Tests
+// ----------------------------------------------------------
+
+TEST_CASE("Graph keeps int vertices and int weights") {
+    CHECK(std::is_same<Graph::VertexType, int>::value);
+    CHECK(std::is_same<Graph::WeightType, int>::value);
+    CHECK(std::is_same<Graph::DistanceType, int>::value);
+    CHECK(std::is_same<Graph::Neighbor, Neighbor>::value);
+    CHECK(sizeof(BasicNeighbor<int, unsigned short>) < sizeof(BasicNeighbor<long long, double>));
+}
+
+TEST_CASE("Dijkstra with double weights and 64-bit vertex ids") {
+    typedef BasicGraph<long long, double> WideGraph;
+    WideGraph g(4);
+    g.addEdge(0, 1, 0.5);
+    g.addEdge(1, 2, 0.25);
+    g.addEdge(0, 2, 1.0);
+    g.addEdge(2, 3, 1.5);
+
+    BasicShortestPathResult<long long, double> r = Algorithms::dijkstraDistances(g, 0);
+    CHECK(r.dist[2] == doctest::Approx(0.75));
+    CHECK(r.dist[3] == doctest::Approx(2.25));
+    CHECK(r.parent[2] == 1);
+
+    WideGraph tree = Algorithms::dijkstra(g, 0);
+    CHECK(tree.getNumVertices() == 4);
+    CHECK(tree.getWeight(1, 2) == doctest::Approx(0.25));
+    CHECK_FALSE(tree.hasEdge(0, 2));
+
+    BasicTraversalResult<long long> t = Algorithms::bfsTraversal(g, 0);
+    CHECK(t.visitedCount == 4);
+    CHECK(t.depth[3] == 2);
+    CHECK(Algorithms::dfsTraversal(g, 3).visitedCount == 4);
+    CHECK_THROWS(Algorithms::bfs(g, 4));
+}
+
+TEST_CASE("Narrow weights add up in a wider distance type") {
+    BasicGraph<int, unsigned short> g(3);
+    g.addEdge(0, 1, 60000);
+    g.addEdge(1, 2, 60000);
+    CHECK(std::is_same<BasicGraph<int, unsigned short>::DistanceType, int>::value);
+    BasicShortestPathResult<int, int> r = Algorithms::dijkstraDistances(g, 0);
+    CHECK(r.dist[2] == 120000);
+}
+
+TEST_CASE("64-bit vertex ids sum integer weights in long long") {
+    typedef BasicGraph<long long, int> WideGraph;
+    CHECK(std::is_same<WideGraph::DistanceType, long long>::value);
+    CHECK(std::is_same<BasicGraph<long long, double>::DistanceType, double>::value);
+
+    WideGraph g(3);
+    g.addEdge(0, 1, 2000000000);
+    g.addEdge(1, 2, 2000000000);
+    BasicShortestPathResult<long long, long long> r = Algorithms::dijkstraDistances(g, 0);
+    CHECK(r.dist[2] == 4000000000LL);
+    CHECK(Algorithms::shortestPath(g, 0, 2).cost == 4000000000LL);
+    CHECK(Algorithms::bidirectionalDijkstra(g, 2, 0).cost == 4000000000LL);
+    CHECK(Algorithms::dijkstra(g, 0).getWeight(1, 2) == 2000000000);
+}
+
+TEST_CASE("Generic algorithms match the int/int versions") {
+    Graph g(300);
+    BasicGraph<int, float> f(300);
+    unsigned seed = 5;
+    for (int i = 0; i < 1200; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int u = (seed >> 8) % 300;
+        seed = seed * 1103515245u + 12345u;
+        int v = (seed >> 8) % 300;
+        int w = 1 + (seed >> 4) % 40;
+        g.addEdge(u, v, w);
+        f.addEdge(u, v, (float)w);
+    }
+    ShortestPathResult expected = Algorithms::dijkstraDistances(g, 7);
+    BasicShortestPathResult<int, float> actual = Algorithms::dijkstraDistances(f, 7);
+    bool same = true;
+    for (int v = 0; v < 300; ++v)
+        if (expected.reachable(v) != actual.reachable(v) ||
+            (expected.reachable(v) && (float)expected.dist[v] != actual.dist[v]))
+            same = false;
+    CHECK(same);
+
+    TraversalResult bfsExpected = Algorithms::bfsTraversal(g, 7);
+    TraversalResult bfsActual = Algorithms::bfsTraversal(f, 7);
+    bool sameOrder = bfsExpected.visitedCount == bfsActual.visitedCount;
+    for (int i = 0; sameOrder && i < bfsExpected.visitedCount; ++i)
+        if (bfsExpected.order[i] != bfsActual.order[i]) sameOrder = false;
+    CHECK(sameOrder);
+}
+
+TEST_CASE("Dijkstra trees keep the input edge weights") {
+    // 1e8 + 1 rounds to 1e8 in float, so dist differences would give 0
+    BasicGraph<int, float> f(3);
+    f.addEdge(0, 1, 1e8f);
+    f.addEdge(1, 2, 1.0f);
+    BasicGraph<int, float> tree = Algorithms::dijkstra(f, 0);
+    REQUIRE(tree.hasEdge(1, 2));
+    CHECK(tree.getWeight(1, 2) == 1.0f);
+    CHECK(tree.getWeight(0, 1) == 1e8f);
+
+    Graph zero(3);
+    zero.addEdge(0, 1, 0);
+    zero.addEdge(1, 2, 4);
+    Graph expected(3);
+    expected.addEdge(0, 1, 0);
+    expected.addEdge(1, 2, 4);
+    CHECK(sameAdjacency(expected, Algorithms::dijkstra(zero, 0)));
+    CHECK(sameAdjacency(expected, Algorithms::dijkstraBuckets(zero, 0)));
+}
+
+// ----------------------------------------------------------
+// Direction-Optimizing BFS Tests
+// ----------------------------------------------------------
+
+// Deterministic pseudo-random graph: a spanning path plus extra edges
+static void addRandomEdges(Graph& g, int extraEdges, unsigned seed) {
+    int n = g.getNumVertices();
+    for (int i = 0; i + 1 < n; ++i)
+        g.addEdge(i, i + 1, 1 + (i % 7));
+    for (int i = 0; i < extraEdges; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int u = (seed >> 8) % n;
+        seed = seed * 1103515245u + 12345u;
+        int v = (seed >> 8) % n;
+        g.addEdge(u, v, 1 + (seed >> 4) % 50);
+    }
+}
+
+// True if every reached vertex has a neighbor parent one level up
+static bool isValidBfsParent(const Graph& g, const TraversalResult& r, const TraversalResult& reference) {
+    for (int v = 0; v < g.getNumVertices(); ++v) {
+        if (r.depth[v] != reference.depth[v]) return false;
+        if (v == r.source || r.depth[v] == -1) continue;
+        bool adjacent = false;
+        for (Neighbor* n = g.getNeighbors(v); n; n = n->next)
+            if (n->vertex == r.parent[v]) adjacent = true;
+        if (!adjacent || r.depth[r.parent[v]] != r.depth[v] - 1) return false;
+    }
+    return true;
+}
+
+TEST_CASE("Direction-optimizing BFS matches BFS depths") {
+    Graph g(3000);
+    addRandomEdges(g, 24000, 7);
+    TraversalResult reference = Algorithms::bfsTraversal(g, 5);
+
+    TraversalResult hybrid = Algorithms::bfsDirectionOptimizingTraversal(g, 5);
+    CHECK(hybrid.visitedCount == reference.visitedCount);
+    CHECK(isValidBfsParent(g, hybrid, reference));
+
+    // alpha huge: bottom-up from the first level; beta huge: never switch back
+    TraversalResult bottomUp = Algorithms::bfsDirectionOptimizingTraversal(g, 5, 1 << 30, 1 << 30);
+    CHECK(isValidBfsParent(g, bottomUp, reference));
+
+    CSRGraph csr(g);
+    TraversalResult fromCsr = Algorithms::bfsDirectionOptimizingTraversal(csr, 5, 1 << 30, 1 << 30);
+    CHECK(isValidBfsParent(g, fromCsr, reference));
+}
+
+TEST_CASE("Direction-optimizing BFS tree and disconnected input") {
+    Graph g(6);
+    g.addEdge(0, 1, 3);
+    g.addEdge(0, 2, 4);
+    g.addEdge(1, 3, 5);
+    g.addEdge(2, 3, 6);
+    g.addEdge(4, 5, 1);
+
+    Graph tree = Algorithms::bfsDirectionOptimizing(g, 0, 1 << 30, 1 << 30);
+    // bottom-up: 3 takes the first frontier vertex in its list, which is 2
+    CHECK(totalTreeWeight(tree) / 2 == 3 + 4 + 6);
+    CHECK(tree.getNeighbors(4) == nullptr);
+    CHECK_THROWS(Algorithms::bfsDirectionOptimizing(g, 6));
+    CHECK_THROWS(Algorithms::bfsDirectionOptimizing(g, 0, 0, 24));
+}
+
+// ----------------------------------------------------------
+// Parallel BFS Tests
+// ----------------------------------------------------------
+
+TEST_CASE("Parallel BFS matches BFS depths for any thread count") {
+    Graph g(5000);
+    addRandomEdges(g, 20000, 11);
+    CSRGraph csr(g);
+    TraversalResult reference = Algorithms::bfsTraversal(g, 0);
+
+    int threadCounts[] = {1, 2, 4, 8};
+    for (int threads : threadCounts) {
+        TraversalResult r = Algorithms::parallelBfsTraversal(csr, 0, threads);
+        CHECK(r.visitedCount == reference.visitedCount);
+        CHECK(r.parent[0] == -1);
+        CHECK(isValidBfsParent(g, r, reference));
+    }
+}
+
+TEST_CASE("Parallel BFS tree on a small graph") {
+    Graph g(5);
+    g.addEdge(0, 1, 2);
+    g.addEdge(1, 2, 3);
+    g.addEdge(3, 4, 1);
+
+    Graph tree = Algorithms::parallelBfs(g, 0, 4);
+    CHECK(totalTreeWeight(tree) / 2 == 5);
+    CHECK(tree.getNeighbors(3) == nullptr);
+    CHECK_NOTHROW(Algorithms::parallelBfs(g, 4));
+    CHECK_THROWS(Algorithms::parallelBfs(g, 5, 2));
+}
+
+TEST_CASE("runParallel reuses its workers across calls of any size") {
+    // Every id runs once per call, and all of them at the same time
+    int threadCounts[] = {8, 3, 5, 2, 8};
+    for (int threads : threadCounts) {
+        std::atomic<int> runs[8];
+        for (int t = 0; t < 8; ++t) runs[t] = 0;
+        Barrier barrier(threads);
+        runParallel(threads, [&](int t) {
+            ++runs[t];
+            barrier.wait();
+        });
+        bool once = true;
+        for (int t = 0; t < 8; ++t)
+            once = once && runs[t] == (t < threads ? 1 : 0);
+        CHECK(once);
+    }
+
+    // A call from inside a body finds the pool busy and uses threads of its own
+    std::atomic<int> inner(0);
+    runParallel(2, [&](int) { runParallel(3, [&](int) { ++inner; }); });
+    CHECK(inner == 6);
+
+    // threadId 0 throwing waits for the others before the exception leaves
+    std::atomic<int> finished(0);
+    CHECK_THROWS(runParallel(4, [&](int t) {
+        if (t == 0) throw "body failed";
+        ++finished;
+    }));
+    CHECK(finished == 3);
+    runParallel(4, [&](int) { ++finished; });
+    CHECK(finished == 7);
+}
+
+// ----------------------------------------------------------
+// Iterative DFS Tests
+// ----------------------------------------------------------
+
+TEST_CASE("DFS handles very deep path graphs") {
+    const int n = 300000;
+    Graph g(n);
+    for (int i = 0; i + 1 < n; ++i)
+        g.addEdge(i, i + 1, 1);
+
+    TraversalResult r = Algorithms::dfsTraversal(g, 0);
+    CHECK(r.visitedCount == n);
+    CHECK(r.depth[n - 1] == n - 1);
+
+    Graph tree = Algorithms::dfs(g, 0);
+    CHECK(tree.getNeighbors(n - 1)->vertex == n - 2);
+}
+
+TEST_CASE("DFS follows neighbor order like the recursive version") {
+    Graph g(5);
+    g.addEdge(0, 1, 1);
+    g.addEdge(0, 2, 1);
+    g.addEdge(1, 3, 1);
+    g.addEdge(2, 3, 1);
+    g.addEdge(3, 4, 1);
+
+    // Neighbor lists are newest-first: 0 -> 2, 1; 2 -> 3, 0; 3 -> 4, 2, 1
+    TraversalResult r = Algorithms::dfsTraversal(g, 0, true);
+    int expectedOrder[] = {0, 2, 3, 4, 1};
+    for (int i = 0; i < 5; ++i)
+        CHECK(r.order[i] == expectedOrder[i]);
+    CHECK(r.parent[1] == 3);
+
+    // discovery/finish of 0,2,3,4,1 nest as 0[2[3[4][1]]]
+    CHECK(r.hasTimestamps());
+    CHECK(r.discovery[0] == 0);
+    CHECK(r.discovery[4] == 3);
+    CHECK(r.finish[4] == 4);
+    CHECK(r.finish[1] == 6);
+    CHECK(r.finish[0] == 9);
+}
+
+TEST_CASE("DFS timestamps nest along tree edges") {
+    Graph g(400);
+    addRandomEdges(g, 1200, 3);
+    CSRGraph csr(g);
+    TraversalResult r = Algorithms::dfsTraversal(csr, 7, true);
+    for (int v = 0; v < 400; ++v) {
+        CHECK(r.discovery[v] < r.finish[v]);
+        if (r.parent[v] != -1) {
+            CHECK(r.discovery[r.parent[v]] < r.discovery[v]);
+            CHECK(r.finish[v] < r.finish[r.parent[v]]);
+        }
+    }
+    CHECK(!Algorithms::dfsTraversal(csr, 7).hasTimestamps());
+}
+
+// ----------------------------------------------------------
+// Boruvka MST Tests
+// ----------------------------------------------------------
+
+TEST_CASE("Boruvka builds the same forest as Kruskal") {
+    Graph g(2000);
+    addRandomEdges(g, 8000, 21); // weights repeat, so ties are common
+    CSRGraph csr(g);
+    Graph expected = Algorithms::kruskal(g);
+
+    int threadCounts[] = {1, 3, 8};
+    for (int threads : threadCounts) {
+        CHECK(sameAdjacency(expected, Algorithms::boruvka(g, threads)));
+        CHECK(sameAdjacency(expected, Algorithms::boruvka(csr, threads)));
+    }
+}
+
+TEST_CASE("Boruvka on disconnected graphs with loops and parallel edges") {
+    Graph g(6);
+    g.addEdge(0, 1, 4);
+    g.addEdge(0, 1, 2);  // parallel, lighter
+    g.addEdge(1, 2, 2);  // tie with the edge above
+    g.addEdge(2, 2, 0);  // self-loop
+    g.addEdge(3, 4, -1); // negative weights are fine for MST
+    g.addEdge(4, 5, 7);
+
+    Graph mst = Algorithms::boruvka(g, 2);
+    CHECK(sameAdjacency(Algorithms::kruskal(g), mst));
+    CHECK(totalTreeWeight(mst) / 2 == 2 + 2 - 1 + 7);
+
+    Graph empty(3);
+    CHECK(totalTreeWeight(Algorithms::boruvka(empty)) == 0);
+}
+
+// ----------------------------------------------------------
+// Edge Sorting and Filter-Kruskal Tests
+// ----------------------------------------------------------
+
+TEST_CASE("sortEdges orders by weight then endpoints") {
+    const int count = 5000;
+    Edge* edges = new Edge[count];
+    unsigned seed = 5;
+    for (int i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        edges[i] = {static_cast<int>((seed >> 4) % 50), static_cast<int>((seed >> 12) % 50),
+                    static_cast<int>((seed >> 20) % 20) - 10};
+    }
+    sortEdges(edges, count);
+    for (int i = 1; i < count; ++i)
+        CHECK(!edgeLess(edges[i], edges[i - 1]));
+    delete[] edges;
+
+    Edge single[] = {{0, 1, 3}};
+    CHECK_NOTHROW(sortEdges(single, 1));
+    CHECK_NOTHROW(sortEdges(nullptr, 0));
+}
+
+TEST_CASE("Kruskal on a large graph matches a full sort") {
+    Graph g(6000);
+    addRandomEdges(g, 30000, 99);
+
+    // Reference: sort every edge, then scan
+    Edge* edges = new Edge[countEdges(g)];
+    int count = collectEdges(g, edges);
+    sortEdges(edges, count);
+    UnionFind uf(6000);
+    Graph reference(6000);
+    for (int i = 0; i < count; ++i) {
+        if (!uf.connected(edges[i].u, edges[i].v)) {
+            uf.unite(edges[i].u, edges[i].v);
+            reference.addEdge(edges[i].u, edges[i].v, edges[i].weight);
+        }
+    }
+    delete[] edges;
+
+    CHECK(sameAdjacency(reference, Algorithms::kruskal(g)));
+    CSRGraph csr(g);
+    CHECK(sameAdjacency(reference, Algorithms::kruskal(csr)));
+}
+
+TEST_CASE("radixSortEdges is stable by weight") {
+    const int count = 200000; // large enough for the parallel path
+    Edge* edges = new Edge[count];
+    Edge* expected = new Edge[count];
+    unsigned seed = 17;
+    for (int i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        // u records the input position, weights include negatives and repeats
+        edges[i] = {i, 0, static_cast<int>((seed >> 8) % 2000) - 1000};
+        expected[i] = edges[i];
+    }
+    mergeSort(expected, 0, count - 1);
+
+    radixSortEdges(edges, count, 4);
+    bool same = true;
+    for (int i = 0; i < count; ++i)
+        if (edges[i].u != expected[i].u || edges[i].weight != expected[i].weight) same = false;
+    CHECK(same);
+
+    delete[] edges;
+    delete[] expected;
+}
+
+TEST_CASE("radixSortEdgesTotal and radix kruskal match edgeLess order") {
+    Graph g(20000);
+    addRandomEdges(g, 80000, 123);
+
+    Edge* edges = new Edge[countEdges(g)];
+    int count = collectEdges(g, edges);
+    radixSortEdgesTotal(edges, count, 3);
+    bool sorted = true;
+    for (int i = 1; i < count; ++i)
+        if (edgeLess(edges[i], edges[i - 1])) sorted = false;
+    CHECK(sorted);
+    delete[] edges;
+
+    Graph expected = Algorithms::kruskal(g);
+    CHECK(sameAdjacency(expected, Algorithms::kruskal(g, 1)));
+    CSRGraph csr(g);
+    CHECK(sameAdjacency(expected, Algorithms::kruskal(csr, 4)));
+}
+
+
+// ----------------------------------------------------------
+// Point-to-Point Shortest Path Tests
+// ----------------------------------------------------------
+
+// True if path is a walk along edges of g whose weights add up to cost
+static bool isPathOf(const Graph& g, const PathResult& p) {
+    if (!p.found() || p.path[0] != p.source || p.path[p.length - 1] != p.target) return false;
+    long long total = 0;
+    for (int i = 0; i + 1 < p.length; ++i) {
+        if (!g.hasEdge(p.path[i], p.path[i + 1])) return false;
+        total += g.getWeight(p.path[i], p.path[i + 1]);
+    }
+    return total == p.cost;
+}
+
+TEST_CASE("shortestPath returns the lighter indirect path") {
+    Graph g(5);
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 2, 2);
+    g.addEdge(0, 2, 10);
+    g.addEdge(2, 3, 1);
+
+    PathResult p = Algorithms::shortestPath(g, 0, 3);
+    REQUIRE(p.found());
+    CHECK(p.cost == 4);
+    REQUIRE(p.length == 4);
+    CHECK(p.path[0] == 0);
+    CHECK(p.path[1] == 1);
+    CHECK(p.path[2] == 2);
+    CHECK(p.path[3] == 3);
+
+    PathResult self = Algorithms::shortestPath(g, 2, 2);
+    CHECK(self.cost == 0);
+    CHECK(self.length == 1);
+    CHECK(self.settled == 1);
+
+    PathResult none = Algorithms::shortestPath(g, 0, 4);
+    CHECK_FALSE(none.found());
+    CHECK(none.length == 0);
+    CHECK(none.cost == std::numeric_limits<int>::max());
+    CHECK(none.settled == 4);
+
+    CHECK_THROWS(Algorithms::shortestPath(g, 0, 5));
+    g.addEdge(3, 4, -1);
+    CHECK_THROWS(Algorithms::shortestPath(g, 0, 4));
+}
+
+TEST_CASE("shortestPath matches dijkstra distances and stops early") {
+    Graph g(3000);
+    addRandomEdges(g, 9000, 99);
+    CSRGraph csr(g);
+    ShortestPathResult all = Algorithms::dijkstraDistances(g, 11);
+
+    bool same = true;
+    for (int t = 0; t < 3000; t += 97) {
+        PathResult p = Algorithms::shortestPath(g, 11, t);
+        PathResult q = Algorithms::shortestPath(csr, 11, t);
+        if (p.cost != all.dist[t] || q.cost != all.dist[t] || !isPathOf(g, p)) same = false;
+    }
+    CHECK(same);
+
+    // Only vertices at most as far as the target get settled
+    int near = g.getNeighbors(11)->vertex;
+    int closer = 0;
+    for (int v = 0; v < 3000; ++v)
+        if (all.dist[v] <= all.dist[near]) ++closer;
+    int settled = Algorithms::shortestPath(g, 11, near).settled;
+    CHECK(settled <= closer);
+    CHECK(settled < 3000);
+}
+
+TEST_CASE("shortestPath on directed and double-weight graphs") {
+    Graph d(3, true);
+    d.addEdge(0, 1, 1);
+    d.addEdge(1, 2, 1);
+    CHECK(Algorithms::shortestPath(d, 0, 2).cost == 2);
+    CHECK_FALSE(Algorithms::shortestPath(d, 2, 0).found());
+
+    BasicGraph<long long, double> g(3);
+    g.addEdge(0, 1, 0.5);
+    g.addEdge(1, 2, 0.25);
+    g.addEdge(0, 2, 1.0);
+    BasicPathResult<long long, double> p = Algorithms::shortestPath(g, 0, 2);
+    CHECK(p.cost == doctest::Approx(0.75));
+    CHECK(p.length == 3);
+
+    BasicPathResult<long long, double> moved(std::move(p));
+    CHECK(moved.path[1] == 1);
+    CHECK(p.path == nullptr);
+}
+
+TEST_CASE("shortestPath reuses a workspace across queries") {
+    Graph g(2000);
+    addRandomEdges(g, 5000, 17);
+    CSRGraph csr(g);
+    SearchWorkspace workspace(2000);
+
+    // Early exits leave queued vertices and stale distances behind
+    bool same = true;
+    for (int source = 0; source < 2000; source += 331) {
+        ShortestPathResult all = Algorithms::dijkstraDistances(g, source);
+        for (int t = 0; t < 2000; t += 89) {
+            PathResult p = Algorithms::shortestPath(g, source, t, workspace);
+            PathResult q = Algorithms::shortestPath(csr, source, t, workspace);
+            PathResult fresh = Algorithms::shortestPath(g, source, t);
+            if (p.cost != all.dist[t] || q.cost != all.dist[t]) same = false;
+            if (p.settled != fresh.settled || p.length != fresh.length) same = false;
+            for (int i = 0; same && i < p.length; ++i)
+                if (p.path[i] != fresh.path[i]) same = false;
+        }
+    }
+    CHECK(same);
+
+    // A failed query does not spoil the next one
+    Graph h(4);
+    h.addEdge(0, 1, 5);
+    h.addEdge(1, 2, -1);
+    h.addEdge(0, 3, 1);
+    SearchWorkspace small(4);
+    CHECK_THROWS(Algorithms::shortestPath(h, 0, 2, small));
+    CHECK(Algorithms::shortestPath(h, 0, 3, small).cost == 1);
+    CHECK(Algorithms::shortestPath(h, 3, 1, small).cost == 6);
+    CHECK_THROWS(Algorithms::shortestPath(g, 0, 1, small));
+
+    BasicGraph<long long, double> d(3);
+    d.addEdge(0, 1, 0.5);
+    d.addEdge(1, 2, 0.25);
+    BasicSearchWorkspace<long long, double> wide(3);
+    CHECK(Algorithms::shortestPath(d, 0, 2, wide).cost == doctest::Approx(0.75));
+    CHECK(Algorithms::shortestPath(d, 2, 1, wide).cost == doctest::Approx(0.25));
+}
+
+TEST_CASE("bidirectionalDijkstra matches shortestPath costs") {
+    Graph g(3000);
+    addRandomEdges(g, 6000, 41);
+    g.addEdge(5, 5, 3);
+    CSRGraph csr(g);
+    ShortestPathResult all = Algorithms::dijkstraDistances(g, 123);
+
+    SearchWorkspace forward(3000), backward(3000);
+    bool same = true;
+    for (int t = 0; t < 3000; t += 61) {
+        PathResult p = Algorithms::bidirectionalDijkstra(g, 123, t);
+        PathResult q = Algorithms::bidirectionalDijkstra(csr, 123, t, forward, backward);
+        if (p.cost != all.dist[t] || q.cost != all.dist[t] || !isPathOf(g, p)) same = false;
+        if (q.settled != p.settled || q.settledBackward != p.settledBackward) same = false;
+    }
+    CHECK(same);
+    CHECK_THROWS(Algorithms::bidirectionalDijkstra(g, 0, 1, forward, forward));
+    SearchWorkspace small(10);
+    CHECK_THROWS(Algorithms::bidirectionalDijkstra(g, 0, 1, forward, small));
+}
+
+TEST_CASE("bidirectionalDijkstra edge cases") {
+    Graph g(6);
+    g.addEdge(0, 1, 4);
+    g.addEdge(1, 2, 4);
+    g.addEdge(0, 3, 1);
+    g.addEdge(3, 4, 1);
+    g.addEdge(4, 2, 1);
+
+    PathResult p = Algorithms::bidirectionalDijkstra(g, 0, 2);
+    CHECK(p.cost == 3);
+    REQUIRE(p.length == 4);
+    CHECK(p.path[1] == 3);
+    CHECK(p.path[2] == 4);
+    CHECK(p.settled > 0);
+    CHECK(p.settledBackward > 0);
+
+    PathResult self = Algorithms::bidirectionalDijkstra(g, 4, 4);
+    CHECK(self.cost == 0);
+    CHECK(self.length == 1);
+
+    CHECK_FALSE(Algorithms::bidirectionalDijkstra(g, 0, 5).found());
+    CHECK_THROWS(Algorithms::bidirectionalDijkstra(g, 0, 6));
+    CHECK_THROWS(Algorithms::bidirectionalDijkstra(Graph(2, true), 0, 1));
+
+    BasicGraph<int, double> f(3);
+    f.addEdge(0, 1, 0.5);
+    f.addEdge(1, 2, 0.5);
+    CHECK(Algorithms::bidirectionalDijkstra(f, 2, 0).cost == doctest::Approx(1.0));
+    BasicSearchWorkspace<int, double> forward(3), backward(3);
+    CHECK(Algorithms::bidirectionalDijkstra(f, 0, 2, forward, backward).cost == doctest::Approx(1.0));
+    CHECK(Algorithms::bidirectionalDijkstra(f, 1, 1, forward, backward).cost == doctest::Approx(0.0));
+}
+
+TEST_CASE("Priority queues report their minimum distance") {
+    PriorityQueue pq(4);
+    CHECK_THROWS(pq.minDistance());
+    pq.insert(2, 7);
+    pq.insert(1, 3);
+    CHECK(pq.minDistance() == 3);
+    DaryPriorityQueue<4, long long, double> dary(4);
+    dary.insert(3, 1.5);
+    dary.insert(0, 0.5);
+    CHECK(dary.minDistance() == doctest::Approx(0.5));
+    CHECK(dary.extractMin() == 0);
+}
+
+TEST_CASE("Priority queues can be cleared and reused") {
+    PriorityQueue pq(5);
+    pq.insert(4, 2);
+    pq.insert(0, 1);
+    pq.extractMin();
+    pq.clear();
+    CHECK(pq.isEmpty());
+    CHECK_FALSE(pq.contains(4));
+    pq.insert(4, 9);
+    pq.insert(0, 8);
+    CHECK(pq.extractMin() == 0);
+    CHECK(pq.getDistance(4) == 9);
+
+    DaryPriorityQueue<4, long long, double> dary(5);
+    dary.insert(1, 0.5);
+    dary.insert(3, 0.25);
+    dary.clear();
+    CHECK_FALSE(dary.contains(1));
+    dary.insert(1, 0.75);
+    CHECK(dary.extractMin() == 1);
+    CHECK(dary.isEmpty());
+}
+
+// ----------------------------------------------------------
+// A* Tests
+// ----------------------------------------------------------
+
+// side x side grid with random weights >= 1 (the edge length), and the
+// grid position of every vertex in x/y
+static void buildWeightedGrid(Graph& g, int side, double* x, double* y, unsigned seed) {
+    for (int r = 0; r < side; ++r) {
+        for (int c = 0; c < side; ++c) {
+            int v = r * side + c;
+            x[v] = c;
+            y[v] = r;
+            seed = seed * 1103515245u + 12345u;
+            if (c + 1 < side) g.addEdge(v, v + 1, 1 + (seed >> 8) % 20);
+            seed = seed * 1103515245u + 12345u;
+            if (r + 1 < side) g.addEdge(v, v + side, 1 + (seed >> 8) % 20);
+        }
+    }
+}
+
+TEST_CASE("A* matches dijkstra with Euclidean and Manhattan heuristics") {
+    const int side = 40, n = side * side;
+    Graph g(n);
+    double* x = new double[n];
+    double* y = new double[n];
+    buildWeightedGrid(g, side, x, y, 3);
+    CSRGraph csr(g);
+    EuclideanHeuristic euclidean(x, y);
+    ManhattanHeuristic manhattan(x, y);
+
+    SearchWorkspace workspace(n);
+    bool same = true, fewer = true;
+    for (int source = 0; source < n; source += 211) {
+        ShortestPathResult all = Algorithms::dijkstraDistances(g, source);
+        for (int t = 0; t < n; t += 37) {
+            PathResult e = Algorithms::astar(g, source, t, euclidean);
+            PathResult m = Algorithms::astar(csr, source, t, manhattan, workspace);
+            if (e.cost != all.dist[t] || m.cost != all.dist[t] || !isPathOf(g, e)) same = false;
+            int plain = Algorithms::shortestPath(g, source, t).settled;
+            if (e.settled > plain || m.settled > e.settled) fewer = false;
+        }
+    }
+    CHECK(same);
+    CHECK(fewer);
+
+    delete[] x;
+    delete[] y;
+}
+
+TEST_CASE("A* stays exact with inconsistent or custom heuristics") {
+    const int side = 30, n = side * side;
+    Graph g(n);
+    double* x = new double[n];
+    double* y = new double[n];
+    buildWeightedGrid(g, side, x, y, 8);
+    // Vertices without a position get a zero estimate, breaking consistency
+    for (int v = 0; v < n; v += 3)
+        x[v] = std::numeric_limits<double>::quiet_NaN();
+    ManhattanHeuristic partial(x, y);
+    auto zero = [](int, int) { return 0; };
+
+    bool same = true;
+    ShortestPathResult all = Algorithms::dijkstraDistances(g, 31);
+    for (int t = 0; t < n; t += 7) {
+        if (Algorithms::astar(g, 31, t, partial).cost != all.dist[t]) same = false;
+        if (Algorithms::astar(g, 31, t, zero).cost != all.dist[t]) same = false;
+    }
+    CHECK(same);
+
+    // Overestimating at 2 settles 1 through the long edge, then reopens it;
+    // settled still counts the four vertices once each
+    Graph reopen(4);
+    reopen.addEdge(0, 1, 4);
+    reopen.addEdge(0, 2, 1);
+    reopen.addEdge(2, 1, 1);
+    reopen.addEdge(1, 3, 5);
+    auto lateTwo = [](int v, int) { return v == 2 ? 5 : 0; };
+    PathResult p = Algorithms::astar(reopen, 0, 3, lateTwo);
+    CHECK(p.cost == 7);
+    CHECK(p.length == 4);
+    CHECK(p.settled == 4);
+
+    CHECK_THROWS(Algorithms::astar(g, 0, n, zero));
+    Graph disconnected(3);
+    CHECK_FALSE(Algorithms::astar(disconnected, 0, 2, zero).found());
+
+    delete[] x;
+    delete[] y;
+}
+
+TEST_CASE("A* on double weights") {
+    double x[3] = {0.0, 1.0, 2.0};
+    double y[3] = {0.0, 0.0, 0.0};
+    BasicGraph<long long, double> g(3);
+    g.addEdge(0, 1, 1.25);
+    g.addEdge(1, 2, 1.5);
+    g.addEdge(0, 2, 3.0);
+    BasicPathResult<long long, double> p = Algorithms::astar(g, 0, 2, EuclideanHeuristic(x, y));
+    CHECK(p.cost == doctest::Approx(2.75));
+    CHECK(p.length == 3);
+}
+
+// ----------------------------------------------------------
+// ALT Landmark Tests
+// ----------------------------------------------------------
+
+TEST_CASE("LandmarkIndex bounds are admissible and queries exact") {
+    const int side = 40, n = side * side;
+    Graph g(n);
+    double* x = new double[n];
+    double* y = new double[n];
+    buildWeightedGrid(g, side, x, y, 12);
+    CSRGraph csr(g);
+
+    LandmarkSelection selections[] = {LandmarkSelection::Farthest, LandmarkSelection::Avoid};
+    for (LandmarkSelection selection : selections) {
+        LandmarkIndex index(g, 8, selection);
+        REQUIRE(index.getNumLandmarks() == 8);
+        bool distinct = true;
+        for (int i = 0; i < 8; ++i)
+            for (int j = 0; j < i; ++j)
+                if (index.landmark(i) == index.landmark(j)) distinct = false;
+        CHECK(distinct);
+
+        SearchWorkspace workspace(n);
+        bool admissible = true, same = true;
+        long long altSettled = 0, plainSettled = 0;
+        for (int source = 0; source < n; source += 173) {
+            ShortestPathResult all = Algorithms::dijkstraDistances(g, source);
+            for (int t = 0; t < n; t += 29) {
+                if (index.lowerBound(source, t) > all.dist[t]) admissible = false;
+                PathResult p = index.shortestPath(g, source, t);
+                PathResult q = index.shortestPath(csr, source, t, workspace);
+                if (p.cost != all.dist[t] || q.cost != all.dist[t] || !isPathOf(g, p)) same = false;
+                altSettled += p.settled;
+                plainSettled += Algorithms::shortestPath(g, source, t).settled;
+            }
+        }
+        CHECK(admissible);
+        CHECK(same);
+        CHECK(altSettled < plainSettled);
+    }
+
+    delete[] x;
+    delete[] y;
+}
+
+TEST_CASE("LandmarkIndex on disconnected and tiny graphs") {
+    Graph g(7);
+    g.addEdge(0, 1, 2);
+    g.addEdge(1, 2, 2);
+    g.addEdge(3, 4, 1);
+    g.addEdge(4, 5, 1);
+
+    LandmarkIndex index(g, 3);
+    CHECK(index.lowerBound(0, 4) == 0);
+    CHECK(index.shortestPath(g, 0, 2).cost == 4);
+    CHECK(index.shortestPath(g, 5, 3).cost == 2);
+    CHECK_FALSE(index.shortestPath(g, 0, 5).found());
+    CHECK(Algorithms::astar(g, 3, 5, index).cost == 2);
+
+    LandmarkIndex all(g, 20, LandmarkSelection::Farthest);
+    CHECK(all.getNumLandmarks() == 7);
+    CHECK(LandmarkIndex(g, 0).lowerBound(0, 2) == 0);
+
+    CHECK_THROWS(LandmarkIndex(g, -1));
+    CHECK_THROWS(LandmarkIndex(Graph(3, true), 1));
+    CHECK_THROWS(index.shortestPath(Graph(6), 0, 1));
+}
+
+TEST_CASE("LandmarkIndex save and load") {
+    const char* path = "test_landmarks.alt";
+    Graph g(200);
+    addRandomEdges(g, 600, 77);
+    LandmarkIndex index(g, 5);
+    index.save(path);
+
+    LandmarkIndex loaded(path);
+    REQUIRE(loaded.getNumVertices() == 200);
+    REQUIRE(loaded.getNumLandmarks() == 5);
+    bool same = true;
+    for (int i = 0; i < 5; ++i) {
+        if (loaded.landmark(i) != index.landmark(i)) same = false;
+        for (int v = 0; v < 200; ++v)
+            if (loaded.distance(i, v) != index.distance(i, v)) same = false;
+    }
+    CHECK(same);
+    CHECK(loaded.shortestPath(g, 3, 150).cost == Algorithms::shortestPath(g, 3, 150).cost);
+
+    LandmarkIndex moved(std::move(loaded));
+    CHECK(moved.getNumLandmarks() == 5);
+    CHECK(loaded.getNumLandmarks() == 0);
+
+    // Truncated and foreign files
+    std::FILE* file = std::fopen(path, "r+b");
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fclose(file);
+    REQUIRE(truncate(path, size - 4) == 0);
+    CHECK_THROWS(LandmarkIndex(path));
+    CSRGraph::save(g, path);
+    CHECK_THROWS(LandmarkIndex(path));
+    CHECK_THROWS(LandmarkIndex("no_such_file.alt"));
+    std::remove(path);
+}